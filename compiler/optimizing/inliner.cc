@@ -31,6 +31,7 @@
 #include "driver/compiler_options.h"
 #include "driver/dex_compilation_unit.h"
 #include "instruction_simplifier.h"
+#include "instrumentation.h"
 #include "intrinsics.h"
 #include "jit/jit.h"
 #include "jit/jit_code_cache.h"
@@ -1464,6 +1465,15 @@ bool HInliner::IsInliningAllowed(ArtMethod* method, const CodeItemDataAccessor&
     return false;
   }
 
+  if (Runtime::Current()->UseJitCompilation() &&
+      Runtime::Current()->GetInstrumentation()->IsDeoptimized(method)) {
+    // Inlining the method would bypass the deoptimization, and the JIT code
+    // cache would immediately invalidate the resulting code anyway.
+    LOG_FAIL_NO_STAT()
+        << "Method " << method->PrettyMethod() << " is not inlined because it is deoptimized";
+    return false;
+  }
+
   return true;
 }
 
@@ -1540,6 +1550,7 @@ bool HInliner::TryBuildAndInline(HInvoke* invoke_instruction,
       LOG_SUCCESS() << "Successfully replaced pattern of invoke "
                     << method->PrettyMethod();
       MaybeRecordStat(stats_, MethodCompilationStat::kReplacedInvokeWithSimplePattern);
+      outermost_graph_->AddInlinedMethod(method);
       return true;
     }
     LOG_FAIL(stats_, MethodCompilationStat::kNotInlinedWont)
@@ -1571,6 +1582,7 @@ bool HInliner::TryBuildAndInline(HInvoke* invoke_instruction,
 
   LOG_SUCCESS() << method->PrettyMethod();
   MaybeRecordStat(stats_, MethodCompilationStat::kInlinedInvoke);
+  outermost_graph_->AddInlinedMethod(method);
   return true;
 }
 
@@ -1033,6 +1033,10 @@ bool HInstructionBuilder::BuildInvokePolymorphic(uint32_t dex_pc,
                                                  const InstructionOperands& operands) {
   const char* shorty = dex_file_->GetShorty(proto_idx);
   DCHECK_EQ(1 + ArtMethod::NumArgRegisters(shorty), operands.GetNumberOfOperands());
+  if (TryBuildInvokePolymorphicAsStatic(dex_pc, method_idx, proto_idx, operands)) {
+    MaybeRecordStat(compilation_stats_, MethodCompilationStat::kDevirtualizedInvokePolymorphic);
+    return true;
+  }
   DataType::Type return_type = DataType::FromShorty(shorty[0]);
   size_t number_of_arguments = strlen(shorty);
   HInvoke* invoke = new (allocator_) HInvokePolymorphic(allocator_,
@@ -1043,6 +1047,84 @@ bool HInstructionBuilder::BuildInvokePolymorphic(uint32_t dex_pc,
   return HandleInvoke(invoke, operands, shorty, /* is_unresolved= */ false);
 }
 
+bool HInstructionBuilder::TryBuildInvokePolymorphicAsStatic(uint32_t dex_pc,
+                                                            uint32_t method_idx,
+                                                            dex::ProtoIndex proto_idx,
+                                                            const InstructionOperands& operands) {
+  // AOT code may reach the callee through the resolution trampoline, which decodes the
+  // invoke instruction at the caller's dex pc, so only do this for JIT-compiled code.
+  if (!Runtime::Current()->UseJitCompilation()) {
+    return false;
+  }
+
+  // Only MethodHandle.invoke() and MethodHandle.invokeExact() are candidates. VarHandle
+  // accessors are left to the runtime.
+  const dex::MethodId& method_id = dex_file_->GetMethodId(method_idx);
+  if (strcmp(dex_file_->GetMethodDeclaringClassDescriptor(method_id),
+             "Ljava/lang/invoke/MethodHandle;") != 0) {
+    return false;
+  }
+  const char* method_name = dex_file_->GetMethodName(method_id);
+  if (strcmp(method_name, "invokeExact") != 0 && strcmp(method_name, "invoke") != 0) {
+    return false;
+  }
+
+  // The handle must come straight from a const-method-handle in this method, so that
+  // its kind, target and type are known from the dex file and it has no nominal type.
+  HInstruction* receiver = LoadLocal(operands.GetOperand(0), DataType::Type::kReference);
+  if (!receiver->IsLoadMethodHandle()) {
+    return false;
+  }
+  const dex::MethodHandleItem& method_handle =
+      dex_file_->GetMethodHandle(receiver->AsLoadMethodHandle()->GetMethodHandleIndex());
+  if (static_cast<DexFile::MethodHandleType>(method_handle.method_handle_type_) !=
+      DexFile::MethodHandleType::kInvokeStatic) {
+    return false;
+  }
+
+  // Proto ids are unique within a dex file, so an identical proto index means the call
+  // site type matches the handle type exactly and both invoke() and invokeExact() reduce
+  // to a plain call of the target without any argument conversion.
+  uint32_t target_method_idx = method_handle.field_or_method_idx_;
+  if (dex_file_->GetMethodId(target_method_idx).proto_idx_ != proto_idx) {
+    return false;
+  }
+
+  ArtMethod* resolved_method = ResolveMethod(target_method_idx, kStatic);
+  if (resolved_method == nullptr) {
+    return false;
+  }
+
+  const char* shorty = dex_file_->GetMethodShorty(target_method_idx);
+  DataType::Type return_type = DataType::FromShorty(shorty[0]);
+  size_t number_of_arguments = strlen(shorty) - 1;
+  HClinitCheck* clinit_check = nullptr;
+  HInvoke* invoke = nullptr;
+  {
+    HInvokeStaticOrDirect::ClinitCheckRequirement clinit_check_requirement
+        = HInvokeStaticOrDirect::ClinitCheckRequirement::kImplicit;
+    ScopedObjectAccess soa(Thread::Current());
+    clinit_check =
+        ProcessClinitCheckForInvoke(dex_pc, resolved_method, &clinit_check_requirement);
+    HInvokeStaticOrDirect::DispatchInfo dispatch_info =
+        HSharpening::SharpenInvokeStaticOrDirect(resolved_method, code_generator_);
+    MethodReference target_method(resolved_method->GetDexFile(),
+                                  resolved_method->GetDexMethodIndex());
+    invoke = new (allocator_) HInvokeStaticOrDirect(allocator_,
+                                                    number_of_arguments,
+                                                    return_type,
+                                                    dex_pc,
+                                                    target_method_idx,
+                                                    resolved_method,
+                                                    dispatch_info,
+                                                    kStatic,
+                                                    target_method,
+                                                    clinit_check_requirement);
+  }
+  // The handle itself is not an argument of the target method.
+  NoReceiverInstructionOperands target_operands(&operands);
+  return HandleInvoke(invoke, target_operands, shorty, /* is_unresolved= */ false, clinit_check);
+}
 
 bool HInstructionBuilder::BuildInvokeCustom(uint32_t dex_pc,
                                             uint32_t call_site_idx,
@@ -171,6 +171,14 @@ class HInstructionBuilder : public ValueObject {
                               dex::ProtoIndex proto_idx,
                               const InstructionOperands& operands);
 
+  // Tries to replace an invoke-polymorphic of MethodHandle.invoke{,Exact} on a
+  // handle loaded with const-method-handle by a direct call to the handle's
+  // target. Returns whether the replacement has been built.
+  bool TryBuildInvokePolymorphicAsStatic(uint32_t dex_pc,
+                                         uint32_t method_idx,
+                                         dex::ProtoIndex proto_idx,
+                                         const InstructionOperands& operands);
+
   // Builds an invocation node for invoke-custom and returns whether the
   // instruction is supported.
   bool BuildInvokeCustom(uint32_t dex_pc,
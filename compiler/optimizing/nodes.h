@@ -361,6 +361,7 @@ class HGraph : public ArenaObject<kArenaAllocGraph> {
         osr_(osr),
         baseline_(baseline),
         cha_single_implementation_list_(allocator->Adapter(kArenaAllocCHA)),
+        inlined_methods_(allocator->Adapter(kArenaAllocInlinedMethods)),
         is_shared_jit_code_(is_shared_jit_code) {
     blocks_.reserve(kDefaultNumberOfBlocks);
   }
@@ -605,6 +606,14 @@ class HGraph : public ArenaObject<kArenaAllocGraph> {
     cha_single_implementation_list_.insert(method);
   }
 
+  ArenaSet<ArtMethod*>& GetInlinedMethods() {
+    return inlined_methods_;
+  }
+
+  void AddInlinedMethod(ArtMethod* method) {
+    inlined_methods_.insert(method);
+  }
+
   bool HasShouldDeoptimizeFlag() const {
     return number_of_cha_guards_ != 0;
   }
@@ -797,6 +806,10 @@ class HGraph : public ArenaObject<kArenaAllocGraph> {
   // List of methods that are assumed to have single implementation.
   ArenaSet<ArtMethod*> cha_single_implementation_list_;
 
+  // List of methods whose code has been inlined into this graph. The JIT records
+  // these so that deoptimizing one of them can invalidate the code inlining it.
+  ArenaSet<ArtMethod*> inlined_methods_;
+
   // Whether we are JIT compiling in the shared region area, putting
   // restrictions on, for example, how literals are being generated.
   bool is_shared_jit_code_;
@@ -1240,6 +1240,8 @@ bool OptimizingCompiler::JitCompile(Thread* self,
     std::vector<Handle<mirror::Object>> roots;
     ArenaSet<ArtMethod*, std::less<ArtMethod*>> cha_single_implementation_list(
         allocator.Adapter(kArenaAllocCHA));
+    ArenaSet<ArtMethod*, std::less<ArtMethod*>> inlined_methods(
+        allocator.Adapter(kArenaAllocInlinedMethods));
     ArenaStack arena_stack(runtime->GetJitArenaPool());
     // StackMapStream is large and it does not fit into this frame, so we need helper method.
     ScopedArenaAllocator stack_map_allocator(&arena_stack);  // Will hold the stack map.
@@ -1293,7 +1295,8 @@ bool OptimizingCompiler::JitCompile(Thread* self,
                             ArrayRef<const uint8_t>(stack_map),
                             osr,
                             /* has_should_deoptimize_flag= */ false,
-                            cha_single_implementation_list)) {
+                            cha_single_implementation_list,
+                            inlined_methods)) {
       code_cache->Free(self, region, reserved_code.data(), reserved_data.data());
       return false;
     }
@@ -1401,7 +1404,8 @@ bool OptimizingCompiler::JitCompile(Thread* self,
                           ArrayRef<const uint8_t>(stack_map),
                           osr,
                           codegen->GetGraph()->HasShouldDeoptimizeFlag(),
-                          codegen->GetGraph()->GetCHASingleImplementationList())) {
+                          codegen->GetGraph()->GetCHASingleImplementationList(),
+                          codegen->GetGraph()->GetInlinedMethods())) {
     code_cache->Free(self, region, reserved_code.data(), reserved_data.data());
     return false;
   }
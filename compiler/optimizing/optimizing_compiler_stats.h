@@ -103,6 +103,7 @@ enum class MethodCompilationStat {
   kConstructorFenceRemovedPFRA,
   kConstructorFenceRemovedCFRE,
   kBitstringTypeCheck,
+  kDevirtualizedInvokePolymorphic,
   kJitOutOfMemoryForCommit,
   kLastStat
 };
@@ -141,6 +141,9 @@ class CompilerDriver::AOTCompilationStats {
       oss << "classes with status " << static_cast<ClassStatus>(i);
       DumpStat(class_status_count_[i], total - class_status_count_[i], oss.str().c_str());
     }
+    DumpStat(transaction_initialized_classes_,
+             transaction_aborted_classes_,
+             "classes initialized by running <clinit> in a transaction");
 
     for (size_t i = 0; i <= kMaxInvokeType; i++) {
       std::ostringstream oss;
@@ -226,6 +229,18 @@ class CompilerDriver::AOTCompilationStats {
     ++class_status_count_[static_cast<size_t>(status)];
   }
 
+  // A class initializer ran to completion in a transaction.
+  void TransactionInitializedClass() REQUIRES(!stats_lock_) {
+    STATS_LOCK();
+    transaction_initialized_classes_++;
+  }
+
+  // A class initializer was aborted and its transaction rolled back.
+  void TransactionAbortedClass() REQUIRES(!stats_lock_) {
+    STATS_LOCK();
+    transaction_aborted_classes_++;
+  }
+
  private:
   Mutex stats_lock_;
 
@@ -249,6 +264,9 @@ class CompilerDriver::AOTCompilationStats {
 
   size_t class_status_count_[static_cast<size_t>(ClassStatus::kLast) + 1] = {};
 
+  size_t transaction_initialized_classes_ = 0u;
+  size_t transaction_aborted_classes_ = 0u;
+
   DISALLOW_COPY_AND_ASSIGN(AOTCompilationStats);
 };
 
@@ -801,14 +819,30 @@ static void InitializeTypeCheckBitstrings(CompilerDriver* driver,
   ClassLinker* const class_linker = Runtime::Current()->GetClassLinker();
   MutableHandle<mirror::DexCache> dex_cache(hs.NewHandle<mirror::DexCache>(nullptr));
 
-  for (const DexFile* dex_file : dex_files) {
-    dex_cache.Assign(class_linker->FindDexCache(soa.Self(), *dex_file));
-    TimingLogger::ScopedTiming t("Initialize type check bitstrings", timings);
-
-    for (ClassAccessor accessor : dex_file->GetClasses()) {
-      // Direct and virtual methods.
-      for (const ClassAccessor::Method& method : accessor.GetMethods()) {
-        InitializeTypeCheckBitstrings(driver, class_linker, dex_cache, *dex_file, method);
+  // Each level of the hierarchy has only a few bits to number the children of a class, and
+  // classes assigned after they run out overflow and fall back to the slower type checks.
+  // If we have a profile, first assign the targets of type checks in hot methods, so that
+  // they get the bitstrings, then the rest.
+  const ProfileCompilationInfo* profile_compilation_info =
+      driver->GetCompilerOptions().GetProfileCompilationInfo();
+  for (bool hot_methods : {true, false}) {
+    if (hot_methods && profile_compilation_info == nullptr) {
+      continue;
+    }
+    for (const DexFile* dex_file : dex_files) {
+      dex_cache.Assign(class_linker->FindDexCache(soa.Self(), *dex_file));
+      TimingLogger::ScopedTiming t("Initialize type check bitstrings", timings);
+
+      for (ClassAccessor accessor : dex_file->GetClasses()) {
+        // Direct and virtual methods.
+        for (const ClassAccessor::Method& method : accessor.GetMethods()) {
+          if (profile_compilation_info != nullptr &&
+              profile_compilation_info->GetMethodHotness(
+                  MethodReference(dex_file, method.GetIndex())).IsHot() != hot_methods) {
+            continue;
+          }
+          InitializeTypeCheckBitstrings(driver, class_linker, dex_cache, *dex_file, method);
+        }
       }
     }
   }
@@ -2226,11 +2260,13 @@ class InitializeClassVisitor : public CompilationVisitor {
         // fields. Limit the max number of encoded fields.
         if (!klass->IsInitialized() &&
             (is_app_image || is_boot_image || is_boot_image_extension) &&
-            try_initialize_with_superclasses &&
-            !too_many_encoded_fields &&
             compiler_options.IsImageClass(descriptor)) {
           bool can_init_static_fields = false;
-          if (is_boot_image || is_boot_image_extension) {
+          if (!try_initialize_with_superclasses) {
+            ReportInitFailure(descriptor, "Rejected: superclass or interface not initialized");
+          } else if (too_many_encoded_fields) {
+            ReportInitFailure(descriptor, "Rejected: too many static fields");
+          } else if (is_boot_image || is_boot_image_extension) {
             // We need to initialize static fields, we only do this for image classes that aren't
             // marked with the $NoPreloadHolder (which implies this should not be initialized
             // early).
@@ -2243,11 +2279,16 @@ class InitializeClassVisitor : public CompilationVisitor {
             // want the <clinit> behavior to be observable for the debugger, so we don't do the
             // <clinit> at compile time.
             can_init_static_fields =
-                ClassLinker::kAppImageMayContainStrings &&
-                !soa.Self()->IsExceptionPending() &&
-                !compiler_options.GetDebuggable() &&
-                (compiler_options.InitializeAppImageClasses() ||
-                 NoClinitInDependency(klass, soa.Self(), &class_loader));
+                ClassLinker::kAppImageMayContainStrings && !soa.Self()->IsExceptionPending();
+            if (can_init_static_fields && compiler_options.GetDebuggable()) {
+              ReportInitFailure(descriptor, "Rejected: debuggable app");
+              can_init_static_fields = false;
+            } else if (can_init_static_fields &&
+                       !compiler_options.InitializeAppImageClasses() &&
+                       !NoClinitInDependency(klass, soa.Self(), &class_loader)) {
+              ReportInitFailure(descriptor, "Rejected: <clinit> in a dependency");
+              can_init_static_fields = false;
+            }
             // TODO The checking for clinit can be removed since it's already
             // checked when init superclass. Currently keep it because it contains
             // processing of intern strings. Will be removed later when intern strings
@@ -2287,6 +2328,7 @@ class InitializeClassVisitor : public CompilationVisitor {
               if (success) {
                 runtime->ExitTransactionMode();
                 DCHECK(!runtime->IsActiveTransaction());
+                manager_->GetCompiler()->stats_->TransactionInitializedClass();
 
                 if (is_boot_image || is_boot_image_extension) {
                   // For boot image and boot image extension, we want to put the updated
@@ -2297,14 +2339,8 @@ class InitializeClassVisitor : public CompilationVisitor {
               } else {
                 CHECK(soa.Self()->IsExceptionPending());
                 mirror::Throwable* exception = soa.Self()->GetException();
-                VLOG(compiler) << "Initialization of " << descriptor << " aborted because of "
-                               << exception->Dump();
-                std::ostream* file_log = manager_->GetCompiler()->
-                    GetCompilerOptions().GetInitFailureOutput();
-                if (file_log != nullptr) {
-                  *file_log << descriptor << "\n";
-                  *file_log << exception->Dump() << "\n";
-                }
+                ReportInitFailure(descriptor, exception->Dump());
+                manager_->GetCompiler()->stats_->TransactionAbortedClass();
                 soa.Self()->ClearException();
                 runtime->RollbackAllTransactions();
                 CHECK_EQ(old_status, klass->GetStatus()) << "Previous class status not restored";
@@ -2352,6 +2388,17 @@ class InitializeClassVisitor : public CompilationVisitor {
   }
 
  private:
+  // Record why `descriptor` was not initialized at compile time, both in the verbose log and
+  // in the file passed with --dump-init-failures, if any.
+  void ReportInitFailure(const char* descriptor, const std::string& reason) {
+    VLOG(compiler) << "Not initializing " << descriptor << ": " << reason;
+    std::ostream* file_log = manager_->GetCompiler()->GetCompilerOptions().GetInitFailureOutput();
+    if (file_log != nullptr) {
+      *file_log << descriptor << "\n";
+      *file_log << reason << "\n";
+    }
+  }
+
   void InternStrings(Handle<mirror::Class> klass, Handle<mirror::ClassLoader> class_loader)
       REQUIRES_SHARED(Locks::mutator_lock_) {
     DCHECK(manager_->GetCompiler()->GetCompilerOptions().IsBootImage() ||
@@ -2877,6 +2924,9 @@ std::string CompilerDriver::GetMemoryUsageString(bool extended) const {
   const gc::Heap* const heap = Runtime::Current()->GetHeap();
   const size_t java_alloc = heap->GetBytesAllocated();
   oss << "arena alloc=" << PrettySize(max_arena_alloc_) << " (" << max_arena_alloc_ << "B)";
+  const ArenaPool* const arena_pool = Runtime::Current()->GetArenaPool();
+  oss << " arenas new=" << arena_pool->GetNumArenasCreated()
+      << " reused=" << arena_pool->GetNumArenasReused();
   oss << " java alloc=" << PrettySize(java_alloc) << " (" << java_alloc << "B)";
 #if defined(__BIONIC__) || defined(__GLIBC__)
   const struct mallinfo info = mallinfo();
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <fstream>
 #include <iostream>
 #include <string>
 #include <string_view>
@@ -50,6 +51,10 @@ enum ReturnCodes {
   // code to communicate that the flattening code path was taken.
   kFlattenClassLoaderContextSuccess = 50,
 
+  // Success return code when executed with --batch-file. The per dex file results
+  // are printed to standard output.
+  kBatchAnalysisSuccess = 51,
+
   kErrorInvalidArguments = 101,
   kErrorCannotCreateRuntime = 102,
   kErrorUnknownDexOptNeeded = 103
@@ -133,6 +138,13 @@ NO_RETURN static void Usage(const char *fmt, ...) {
   UsageError("      print a colon-separated list of its dex files to standard output. Dexopt");
   UsageError("      needed analysis is not performed when this option is set.");
   UsageError("");
+  UsageError("  --batch-file=<filename>: analyze all the dex files listed in <filename> with a");
+  UsageError("      single runtime. Each line holds a dex file, optionally followed by a tab");
+  UsageError("      and its class loader context. Dex file paths may contain spaces but not");
+  UsageError("      tabs. For each line, the dex file and its return code are printed to");
+  UsageError("      standard output, separated by a tab. Cannot be used with --dex-file, the");
+  UsageError("      file descriptor options or --class-loader-context.");
+  UsageError("");
   UsageError("Return code:");
   UsageError("  To make it easier to integrate with the internal tools this command will make");
   UsageError("    available its result (dexoptNeeded) as the exit/return code. i.e. it will not");
@@ -144,6 +156,7 @@ NO_RETURN static void Usage(const char *fmt, ...) {
   UsageError("        kDex2OatForFilterOat = 3");
   UsageError("        kDex2OatForBootImageOdex = 4");
   UsageError("        kDex2OatForFilterOdex = 5");
+  UsageError("        kBatchAnalysisSuccess = 51 (with --batch-file)");
 
   UsageError("        kErrorInvalidArguments = 101");
   UsageError("        kErrorCannotCreateRuntime = 102");
@@ -236,11 +249,23 @@ class DexoptAnalyzer final {
         }
       } else if (option == "--flatten-class-loader-context") {
         only_flatten_context_ = true;
+      } else if (StartsWith(option, "--batch-file=")) {
+        batch_file_ = std::string(option.substr(strlen("--batch-file=")));
       } else {
         Usage("Unknown argument '%s'", raw_option);
       }
     }
 
+    if (!batch_file_.empty()) {
+      if (!dex_file_.empty() || !context_str_.empty() || !context_fds_.empty() ||
+          oat_fd_ != -1 || vdex_fd_ != -1 || zip_fd_ != -1) {
+        Usage("--batch-file cannot be used with a single dex file, its context or fds");
+      }
+      if (only_flatten_context_) {
+        Usage("--batch-file cannot be used with --flatten-class-loader-context");
+      }
+    }
+
     if (image_.empty()) {
       // If we don't receive the image, try to use the default one.
       // Tests may specify a different image (e.g. core image).
@@ -304,14 +329,82 @@ class DexoptAnalyzer final {
       }
     }
 
+    return AnalyzeDexFile(dex_file_,
+                          class_loader_context.get(),
+                          context_fds_,
+                          vdex_fd_,
+                          oat_fd_,
+                          zip_fd_,
+                          /*previous_assistant=*/ nullptr);
+  }
+
+  int GetDexOptNeededForBatch() const {
+    std::ifstream batch(batch_file_);
+    if (!batch.good()) {
+      LOG(ERROR) << "Could not open batch file " << batch_file_;
+      return kErrorInvalidArguments;
+    }
+
+    // The runtime, and with it the boot image, is shared by all the dex files of the batch.
+    if (!CreateRuntime()) {
+      return kErrorCannotCreateRuntime;
+    }
+    std::unique_ptr<Runtime> runtime(Runtime::Current());
+
+    std::unique_ptr<OatFileAssistant> previous_assistant;
+    std::string line;
+    while (std::getline(batch, line)) {
+      if (line.empty()) {
+        continue;
+      }
+      // Split at a tab, which unlike spaces does not occur in dex file paths in practice.
+      size_t separator = line.find('\t');
+      std::string dex_file = line.substr(0, separator);
+      std::string context_str =
+          (separator != std::string::npos) ? line.substr(separator + 1) : std::string();
+
+      int result;
+      std::unique_ptr<ClassLoaderContext> class_loader_context;
+      if (!context_str.empty() &&
+          (class_loader_context = ClassLoaderContext::Create(context_str)) == nullptr) {
+        LOG(ERROR) << "Invalid class loader context '" << context_str << "' for " << dex_file;
+        result = kErrorInvalidArguments;
+      } else {
+        result = AnalyzeDexFile(dex_file,
+                                class_loader_context.get(),
+                                /*context_fds=*/ std::vector<int>(),
+                                /*vdex_fd=*/ -1,
+                                /*oat_fd=*/ -1,
+                                /*zip_fd=*/ -1,
+                                &previous_assistant);
+      }
+      std::cout << dex_file << '\t' << result << '\n';
+    }
+    std::cout << std::flush;
+    return kBatchAnalysisSuccess;
+  }
+
+  // Returns the dexoptanalyzer code for `dex_file`. If `previous_assistant` is not null,
+  // the boot class path checksums it validated are reused, and it is replaced by the
+  // assistant used for `dex_file`.
+  int AnalyzeDexFile(const std::string& dex_file,
+                     ClassLoaderContext* class_loader_context,
+                     const std::vector<int>& context_fds,
+                     int vdex_fd,
+                     int oat_fd,
+                     int zip_fd,
+                     std::unique_ptr<OatFileAssistant>* previous_assistant) const {
     std::unique_ptr<OatFileAssistant> oat_file_assistant;
-    oat_file_assistant = std::make_unique<OatFileAssistant>(dex_file_.c_str(),
+    oat_file_assistant = std::make_unique<OatFileAssistant>(dex_file.c_str(),
                                                             isa_,
                                                             /*load_executable=*/ false,
                                                             /*only_load_system_executable=*/ false,
-                                                            vdex_fd_,
-                                                            oat_fd_,
-                                                            zip_fd_);
+                                                            vdex_fd,
+                                                            oat_fd,
+                                                            zip_fd);
+    if (previous_assistant != nullptr && *previous_assistant != nullptr) {
+      oat_file_assistant->CopyValidatedBootClassPathChecksums(**previous_assistant);
+    }
     // Always treat elements of the bootclasspath as up-to-date.
     // TODO(calin): this check should be in OatFileAssistant.
     if (oat_file_assistant->IsInBootClassPath()) {
@@ -319,10 +412,13 @@ class DexoptAnalyzer final {
     }
 
     int dexoptNeeded = oat_file_assistant->GetDexOptNeeded(compiler_filter_,
-                                                           class_loader_context.get(),
-                                                           context_fds_,
+                                                           class_loader_context,
+                                                           context_fds,
                                                            assume_profile_changed_,
                                                            downgrade_);
+    if (previous_assistant != nullptr) {
+      *previous_assistant = std::move(oat_file_assistant);
+    }
 
     // Convert OatFileAssitant codes to dexoptanalyzer codes.
     switch (dexoptNeeded) {
@@ -357,6 +453,8 @@ class DexoptAnalyzer final {
   int Run() const {
     if (only_flatten_context_) {
       return FlattenClassLoaderContext();
+    } else if (!batch_file_.empty()) {
+      return GetDexOptNeededForBatch();
     } else {
       return GetDexOptNeeded();
     }
@@ -367,6 +465,7 @@ class DexoptAnalyzer final {
   InstructionSet isa_;
   CompilerFilter::Filter compiler_filter_;
   std::string context_str_;
+  std::string batch_file_;
   bool only_flatten_context_;
   bool assume_profile_changed_;
   bool downgrade_;
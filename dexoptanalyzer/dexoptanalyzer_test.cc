@@ -335,4 +335,66 @@ TEST_F(DexoptAnalyzerTest, ClassLoaderContext) {
 
   Verify(dex_location1, CompilerFilter::kSpeed, false, false, class_loader_context.c_str());
 }
+
+// Case: We analyze several dex files, with and without class loader contexts, in one batch.
+// Dex file paths may contain spaces.
+TEST_F(DexoptAnalyzerTest, Batch) {
+  std::string dex_location1 = GetScratchDir() + "/Batch Dex No Oat.jar";
+  std::string dex_location2 = GetScratchDir() + "/BatchOatUpToDate.jar";
+  std::string dex_location3 = GetScratchDir() + "/BatchDexInContext.jar";
+  Copy(GetDexSrc1(), dex_location1);
+  Copy(GetDexSrc1(), dex_location2);
+  Copy(GetDexSrc2(), dex_location3);
+  GenerateOatForTest(dex_location2.c_str(), CompilerFilter::kSpeed);
+
+  std::string batch_file = GetScratchDir() + "/batch.txt";
+  {
+    std::unique_ptr<File> file(OS::CreateEmptyFile(batch_file.c_str()));
+    ASSERT_TRUE(file != nullptr);
+    std::string batch = dex_location1 + "\n" +
+        dex_location2 + "\tPCL[]\n" +
+        dex_location2 + "\tPCL[" + dex_location3 + "]\n";
+    ASSERT_TRUE(file->WriteFully(batch.data(), batch.size()));
+    ASSERT_EQ(0, file->FlushClose());
+  }
+
+  std::vector<std::string> argv_str;
+  argv_str.push_back(GetDexoptAnalyzerCmd());
+  argv_str.push_back("--batch-file=" + batch_file);
+  argv_str.push_back("--isa=" + std::string(GetInstructionSetString(kRuntimeISA)));
+  argv_str.push_back("--compiler-filter=" + CompilerFilter::NameOfFilter(CompilerFilter::kSpeed));
+  argv_str.push_back("--runtime-arg");
+  argv_str.push_back(GetClassPathOption("-Xbootclasspath:", GetLibCoreDexFileNames()));
+  argv_str.push_back("--runtime-arg");
+  argv_str.push_back(GetClassPathOption("-Xbootclasspath-locations:", GetLibCoreDexLocations()));
+  argv_str.push_back("--image=" + GetImageLocation());
+  argv_str.push_back("--android-data=" + android_data_);
+
+  std::string output;
+  ForkAndExecResult result = ForkAndExec(argv_str, []() { return true; }, &output);
+  ASSERT_EQ(ForkAndExecResult::kFinished, result.stage) << output;
+  ASSERT_TRUE(WIFEXITED(result.status_code)) << output;
+  EXPECT_EQ(51, WEXITSTATUS(result.status_code)) << output;
+
+  std::unique_ptr<ClassLoaderContext> empty_context = ClassLoaderContext::Create("PCL[]");
+  std::unique_ptr<ClassLoaderContext> other_context =
+      ClassLoaderContext::Create("PCL[" + dex_location3 + "]");
+  auto expected_line = [&](const std::string& dex_location, ClassLoaderContext* context) {
+    OatFileAssistant oat_file_assistant(dex_location.c_str(), kRuntimeISA, false);
+    int assistant_result = oat_file_assistant.GetDexOptNeeded(
+        CompilerFilter::kSpeed, context, std::vector<int>(), false, false);
+    int code = 0;
+    for (; code <= 5; ++code) {
+      if (DexoptanalyzerToOatFileAssistant(code) == assistant_result) {
+        break;
+      }
+    }
+    return dex_location + "\t" + std::to_string(code) + "\n";
+  };
+  EXPECT_NE(std::string::npos, output.find(expected_line(dex_location1, nullptr))) << output;
+  EXPECT_NE(std::string::npos, output.find(expected_line(dex_location2, empty_context.get())))
+      << output;
+  EXPECT_NE(std::string::npos, output.find(expected_line(dex_location2, other_context.get())))
+      << output;
+}
 }  // namespace art
@@ -92,6 +92,7 @@ const char* const ArenaAllocatorStatsImpl<kCount>::kAllocNames[] = {
   "Verifier     ",
   "CallingConv  ",
   "CHA          ",
+  "InlinedMeth  ",
   "Scheduler    ",
   "Profile      ",
   "SBCloner     ",
@@ -188,6 +189,18 @@ void ArenaAllocatorMemoryTool::DoMakeInaccessible(void* ptr, size_t size) {
 Arena::Arena() : bytes_allocated_(0), memory_(nullptr), size_(0), next_(nullptr) {
 }
 
+void ArenaPool::DumpStats(std::ostream& os) const {
+  const size_t created = GetNumArenasCreated();
+  const size_t reused = GetNumArenasReused();
+  const size_t total = created + reused;
+  os << "Arena pool: " << total << " arena requests, " << created << " new, " << reused
+     << " reused";
+  if (total != 0u) {
+    os << " (" << std::fixed << std::setprecision(1) << (100.0 * reused / total) << "% reuse)";
+  }
+  os << ", " << GetBytesAllocated() << " bytes in free arenas\n";
+}
+
 size_t ArenaAllocator::BytesAllocated() const {
   return ArenaAllocatorStats::BytesAllocated();
 }
@@ -20,6 +20,9 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <atomic>
+#include <iosfwd>
+
 #include "bit_utils.h"
 #include "debug_stack.h"
 #include "dchecked_vector.h"
@@ -101,6 +104,7 @@ enum ArenaAllocKind {
   kArenaAllocVerifier,
   kArenaAllocCallingConvention,
   kArenaAllocCHA,
+  kArenaAllocInlinedMethods,
   kArenaAllocScheduler,
   kArenaAllocProfile,
   kArenaAllocSuperblockCloner,
@@ -237,10 +241,31 @@ class ArenaPool {
   // Trim the maps in arenas by madvising, used by JIT to reduce memory usage.
   virtual void TrimMaps() = 0;
 
+  // Number of arenas the pool had to create because no free arena was large enough.
+  size_t GetNumArenasCreated() const {
+    return num_arenas_created_.load(std::memory_order_relaxed);
+  }
+
+  // Number of arena requests satisfied from the free list.
+  size_t GetNumArenasReused() const {
+    return num_arenas_reused_.load(std::memory_order_relaxed);
+  }
+
+  // Dump the pool counters. Unlike ArenaAllocatorStats these are kept in all builds, they
+  // cost a single relaxed increment per arena handed out.
+  void DumpStats(std::ostream& os) const;
+
  protected:
   ArenaPool() = default;
 
+  void RecordArenaAlloc(bool reused) {
+    (reused ? num_arenas_reused_ : num_arenas_created_).fetch_add(1u, std::memory_order_relaxed);
+  }
+
  private:
+  std::atomic<size_t> num_arenas_created_{0u};
+  std::atomic<size_t> num_arenas_reused_{0u};
+
   DISALLOW_COPY_AND_ASSIGN(ArenaPool);
 };
 
@@ -44,6 +44,30 @@ TEST_F(ArenaAllocatorTest, Test) {
   EXPECT_EQ(2U, bv.GetStorageSize());
 }
 
+TEST_F(ArenaAllocatorTest, PoolStats) {
+  MallocArenaPool pool;
+  EXPECT_EQ(0u, pool.GetNumArenasCreated());
+  EXPECT_EQ(0u, pool.GetNumArenasReused());
+  {
+    ArenaAllocator allocator(&pool);
+    allocator.Alloc(1u);
+  }
+  EXPECT_EQ(1u, pool.GetNumArenasCreated());
+  EXPECT_EQ(0u, pool.GetNumArenasReused());
+  {
+    ArenaAllocator allocator(&pool);
+    allocator.Alloc(1u);
+  }
+  if (arena_allocator::kArenaAllocatorPreciseTracking) {
+    // Arenas are not reused when tracking.
+    EXPECT_EQ(2u, pool.GetNumArenasCreated());
+    EXPECT_EQ(0u, pool.GetNumArenasReused());
+  } else {
+    EXPECT_EQ(1u, pool.GetNumArenasCreated());
+    EXPECT_EQ(1u, pool.GetNumArenasReused());
+  }
+}
+
 TEST_F(ArenaAllocatorTest, MakeDefined) {
   // Regression test to make sure we mark the allocated area defined.
   MallocArenaPool pool;
@@ -36,6 +36,27 @@ class BitMemoryRegion final : public ValueObject {
     }
   };
 
+  // Hash and equality of the region contents, independent of the bit offset in memory.
+  struct ContentHash {
+    size_t operator()(const BitMemoryRegion& region) const {
+      constexpr uint32_t kFnvPrime = 16777619u;
+      uint32_t hash = 2166136261u ^ static_cast<uint32_t>(region.size_in_bits());
+      size_t bit = 0;
+      constexpr size_t kNumBits = BitSizeOf<uint32_t>();
+      for (; bit + kNumBits <= region.size_in_bits(); bit += kNumBits) {
+        hash = (hash ^ region.LoadBits(bit, kNumBits)) * kFnvPrime;
+      }
+      hash = (hash ^ region.LoadBits(bit, region.size_in_bits() - bit)) * kFnvPrime;
+      return hash;
+    }
+  };
+
+  struct ContentEquals {
+    bool operator()(const BitMemoryRegion& lhs, const BitMemoryRegion& rhs) const {
+      return Compare(lhs, rhs) == 0;
+    }
+  };
+
   BitMemoryRegion() = default;
   ALWAYS_INLINE BitMemoryRegion(uint8_t* data, ssize_t bit_start, size_t bit_size) {
     // Normalize the data pointer. Note that bit_start may be negative.
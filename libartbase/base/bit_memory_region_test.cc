@@ -98,4 +98,32 @@ TEST(BitMemoryRegion, TestBits) {
   }
 }
 
+TEST(BitMemoryRegion, TestContentHashAndEquals) {
+  constexpr size_t kBitLength = 3 * sizeof(uint32_t) * kBitsPerByte + 5;
+  uint8_t data1[sizeof(uint32_t) * 5];
+  uint8_t data2[sizeof(uint32_t) * 5];
+  BitMemoryRegion::ContentHash hash;
+  BitMemoryRegion::ContentEquals equals;
+  for (size_t bit_offset1 = 0; bit_offset1 < kBitsPerByte; ++bit_offset1) {
+    for (size_t bit_offset2 = 0; bit_offset2 < sizeof(uint32_t) * kBitsPerByte; ++bit_offset2) {
+      std::fill_n(data1, sizeof(data1), 0);
+      std::fill_n(data2, sizeof(data2), 0xFF);
+      BitMemoryRegion bmr1(MemoryRegion(&data1, sizeof(data1)), bit_offset1, kBitLength);
+      BitMemoryRegion bmr2(MemoryRegion(&data2, sizeof(data2)), bit_offset2, kBitLength);
+      for (size_t bit = 0; bit < kBitLength; ++bit) {
+        bmr1.StoreBit(bit, (bit % 3) == 0);
+        bmr2.StoreBit(bit, (bit % 3) == 0);
+      }
+      // Same contents at different bit offsets.
+      EXPECT_TRUE(equals(bmr1, bmr2));
+      EXPECT_EQ(hash(bmr1), hash(bmr2));
+      // Different contents.
+      bmr2.StoreBit(kBitLength - 1, !bmr2.LoadBit(kBitLength - 1));
+      EXPECT_FALSE(equals(bmr1, bmr2));
+      // Different lengths.
+      EXPECT_FALSE(equals(bmr1, bmr1.Subregion(0, kBitLength - 1)));
+    }
+  }
+}
+
 }  // namespace art
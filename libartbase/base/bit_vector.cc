@@ -103,16 +103,16 @@ bool BitVector::IsSubsetOf(const BitVector *other) const {
     return false;
   }
 
-  // Compare each 32-bit word.
+  // Compare each 32-bit word. Accumulate the bits missing from `other` rather than returning
+  // at the first mismatch so that the loop has no early exit and can be vectorized.
   size_t this_highest_index = BitsToWords(this_highest + 1);
+  const uint32_t* this_storage = storage_;
+  const uint32_t* other_storage = other->storage_;
+  uint32_t missing_bits = 0u;
   for (size_t i = 0; i < this_highest_index; ++i) {
-    uint32_t this_storage = storage_[i];
-    uint32_t other_storage = other->storage_[i];
-    if ((this_storage | other_storage) != other_storage) {
-      return false;
-    }
+    missing_bits |= this_storage[i] & ~other_storage[i];
   }
-  return true;
+  return missing_bits == 0u;
 }
 
 void BitVector::Intersect(const BitVector* src) {
@@ -121,9 +121,11 @@ void BitVector::Intersect(const BitVector* src) {
   // Get the minimum size between us and source.
   uint32_t min_size = (storage_size_ < src_storage_size) ? storage_size_ : src_storage_size;
 
+  uint32_t* storage = storage_;
+  const uint32_t* src_storage = src->GetRawStorage();
   uint32_t idx;
   for (idx = 0; idx < min_size; idx++) {
-    storage_[idx] &= src->GetRawStorageWord(idx);
+    storage[idx] &= src_storage[idx];
   }
 
   // Now, due to this being an intersection, there are two possibilities:
@@ -131,7 +133,7 @@ void BitVector::Intersect(const BitVector* src) {
   //   - Either we are larger than src: we don't care, all upper bits would have been 0 too.
   // So all we need to do is set all remaining bits to 0.
   for (; idx < storage_size_; idx++) {
-    storage_[idx] = 0;
+    storage[idx] = 0;
   }
 }
 
@@ -158,15 +160,17 @@ bool BitVector::Union(const BitVector* src) {
     DCHECK_LT(static_cast<uint32_t> (highest_bit), storage_size_ * kWordBits);
   }
 
+  // Track the changed bits instead of branching on each word so that the loop vectorizes.
+  uint32_t* storage = storage_;
+  const uint32_t* src_storage = src->GetRawStorage();
+  uint32_t changed_bits = 0u;
   for (uint32_t idx = 0; idx < src_size; idx++) {
-    uint32_t existing = storage_[idx];
-    uint32_t update = existing | src->GetRawStorageWord(idx);
-    if (existing != update) {
-      changed = true;
-      storage_[idx] = update;
-    }
+    uint32_t existing = storage[idx];
+    uint32_t update = existing | src_storage[idx];
+    changed_bits |= existing ^ update;
+    storage[idx] = update;
   }
-  return changed;
+  return changed || changed_bits != 0u;
 }
 
 bool BitVector::UnionIfNotIn(const BitVector* union_with, const BitVector* not_in) {
@@ -192,26 +196,26 @@ bool BitVector::UnionIfNotIn(const BitVector* union_with, const BitVector* not_i
 
   uint32_t not_in_size = not_in->GetStorageSize();
 
+  // As in Union(), accumulate the changed bits so that the loops vectorize.
+  uint32_t* storage = storage_;
+  const uint32_t* union_with_storage = union_with->GetRawStorage();
+  const uint32_t* not_in_storage = not_in->GetRawStorage();
+  uint32_t changed_bits = 0u;
   uint32_t idx = 0;
-  for (; idx < std::min(not_in_size, union_with_size); idx++) {
-    uint32_t existing = storage_[idx];
-    uint32_t update = existing |
-        (union_with->GetRawStorageWord(idx) & ~not_in->GetRawStorageWord(idx));
-    if (existing != update) {
-      changed = true;
-      storage_[idx] = update;
-    }
+  for (const uint32_t min_size = std::min(not_in_size, union_with_size); idx < min_size; idx++) {
+    uint32_t existing = storage[idx];
+    uint32_t update = existing | (union_with_storage[idx] & ~not_in_storage[idx]);
+    changed_bits |= existing ^ update;
+    storage[idx] = update;
   }
 
   for (; idx < union_with_size; idx++) {
-    uint32_t existing = storage_[idx];
-    uint32_t update = existing | union_with->GetRawStorageWord(idx);
-    if (existing != update) {
-      changed = true;
-      storage_[idx] = update;
-    }
+    uint32_t existing = storage[idx];
+    uint32_t update = existing | union_with_storage[idx];
+    changed_bits |= existing ^ update;
+    storage[idx] = update;
   }
-  return changed;
+  return changed || changed_bits != 0u;
 }
 
 void BitVector::Subtract(const BitVector *src) {
@@ -224,8 +228,10 @@ void BitVector::Subtract(const BitVector *src) {
   //   There is no need to do more:
   //     If we are bigger than src, the upper bits are unchanged.
   //     If we are smaller than src, the nonexistent upper bits are 0 and thus can't get subtracted.
+  uint32_t* storage = storage_;
+  const uint32_t* src_storage = src->GetRawStorage();
   for (uint32_t idx = 0; idx < min_size; idx++) {
-    storage_[idx] &= (~(src->GetRawStorageWord(idx)));
+    storage[idx] &= ~src_storage[idx];
   }
 }
 
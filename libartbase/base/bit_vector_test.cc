@@ -141,6 +141,30 @@ TEST(BitVector, SetInitialBits) {
   EXPECT_EQ(64u, bv.NumSetBits());
 }
 
+TEST(BitVector, Union) {
+  BitVector first(256, false, Allocator::GetMallocAllocator());
+  BitVector second(256, false, Allocator::GetMallocAllocator());
+
+  EXPECT_FALSE(first.Union(&second));
+
+  second.SetBit(3);
+  second.SetBit(200);
+  EXPECT_TRUE(first.Union(&second));
+  EXPECT_EQ(2u, first.NumSetBits());
+  EXPECT_TRUE(first.IsBitSet(200));
+  EXPECT_TRUE(second.IsSubsetOf(&first));
+
+  // A second union with the same bits changes nothing, even in the last word.
+  EXPECT_FALSE(first.Union(&second));
+
+  first.SetBit(100);
+  EXPECT_FALSE(first.Union(&second));
+  EXPECT_FALSE(first.IsSubsetOf(&second));
+  second.SetBit(255);
+  EXPECT_TRUE(first.Union(&second));
+  EXPECT_EQ(4u, first.NumSetBits());
+}
+
 TEST(BitVector, UnionIfNotIn) {
   {
     BitVector first(2, true, Allocator::GetMallocAllocator());
@@ -609,6 +609,12 @@ class HashSet {
     if (UNLIKELY(num_buckets_ == 0)) {
       return 0;
     }
+    // Most hash functions used with HashSet produce 32-bit values, and the bucket count always
+    // fits in 32 bits in practice. A 32-bit division yields the same index and is several times
+    // cheaper than a 64-bit one on common 64-bit cores. This is on the path of every lookup.
+    if (LIKELY((static_cast<uint64_t>(hash | num_buckets_) >> 32) == 0u)) {
+      return static_cast<uint32_t>(hash) % static_cast<uint32_t>(num_buckets_);
+    }
     return hash % num_buckets_;
   }
 
@@ -373,6 +373,69 @@ TEST_F(HashSetTest, StringSearchStringView) {
   ASSERT_TRUE(it == insert_pos);
 }
 
+// Hash values on both sides of 2^32 must map to the same buckets whichever division is used.
+struct WideHashFn {
+  size_t operator()(uint64_t value) const {
+    return static_cast<size_t>(value * UINT64_C(0x9e3779b97f4a7c15));
+  }
+};
+
+// Insert 1..count into a set that does not need to grow and check that each slot of the written
+// table holds the element that linear probing from `hash % NumBuckets()`, computed with a 64-bit
+// division, puts there.
+template <typename HashFn>
+static void CheckBucketPlacement(uint64_t count) {
+  HashSet<uint64_t, DefaultEmptyFn<uint64_t>, HashFn> hash_set;
+  hash_set.reserve(count);
+  const size_t num_buckets = hash_set.NumBuckets();
+  std::vector<uint64_t> expected(num_buckets, 0u);
+  HashFn hash_fn;
+  for (uint64_t i = 1; i <= count; ++i) {
+    hash_set.insert(i);
+    uint64_t index = static_cast<uint64_t>(hash_fn(i)) % static_cast<uint64_t>(num_buckets);
+    while (expected[index] != 0u) {
+      index = (index + 1u) % num_buckets;
+    }
+    expected[index] = i;
+  }
+  ASSERT_EQ(num_buckets, hash_set.NumBuckets());
+
+  // The elements are written last, after the header.
+  const size_t size = hash_set.WriteToMemory(nullptr);
+  std::vector<uint64_t> buffer(RoundUp(size, sizeof(uint64_t)) / sizeof(uint64_t));
+  ASSERT_EQ(size, hash_set.WriteToMemory(reinterpret_cast<uint8_t*>(buffer.data())));
+  ASSERT_GE(size, num_buckets * sizeof(uint64_t));
+  const uint8_t* data =
+      reinterpret_cast<const uint8_t*>(buffer.data()) + size - num_buckets * sizeof(uint64_t);
+  for (size_t i = 0; i < num_buckets; ++i) {
+    uint64_t element;
+    memcpy(&element, data + i * sizeof(uint64_t), sizeof(element));
+    EXPECT_EQ(expected[i], element) << i;
+  }
+}
+
+TEST_F(HashSetTest, TestWideAndNarrowHashes) {
+  HashSet<uint64_t, DefaultEmptyFn<uint64_t>, WideHashFn> wide_set;
+  HashSet<uint64_t> narrow_set;
+  static constexpr uint64_t kCount = 10000u;
+  for (uint64_t i = 1; i <= kCount; ++i) {
+    wide_set.insert(i);
+    narrow_set.insert(i);
+  }
+  for (uint64_t i = 1; i <= kCount; i += 2) {
+    wide_set.erase(wide_set.find(i));
+    narrow_set.erase(narrow_set.find(i));
+  }
+  for (uint64_t i = 1; i <= kCount; ++i) {
+    bool expected = (i % 2u) == 0u;
+    EXPECT_EQ(expected, wide_set.find(i) != wide_set.end()) << i;
+    EXPECT_EQ(expected, narrow_set.find(i) != narrow_set.end()) << i;
+  }
+
+  CheckBucketPlacement<WideHashFn>(kCount);
+  CheckBucketPlacement<DefaultHashFn<uint64_t>>(kCount);
+}
+
 TEST_F(HashSetTest, DoubleInsert) {
   const char* test_string = "dummy";
   HashSet<std::string> hash_set;
@@ -59,6 +59,31 @@ static inline uint32_t DecodeUnsignedLeb128WithoutMovingCursor(const uint8_t* da
   return DecodeUnsignedLeb128(&data);
 }
 
+// Reads `kCount` consecutive unsigned LEB128 values into `out`, updating the given pointer to
+// point just past the end of the last value. When every value fits in a single byte, which is
+// the common case for small indexes, counts and access flags in dex class data, the whole group
+// is checked and copied at once instead of branching on each byte. Only the first `kCount`
+// bytes are examined, and those are always part of the encoded values.
+template <size_t kCount>
+static inline void DecodeUnsignedLeb128Batch(const uint8_t** data, uint32_t* out) {
+  static_assert(kCount != 0u, "Empty LEB128 batch");
+  const uint8_t* ptr = *data;
+  uint8_t high_bits = 0u;
+  for (size_t i = 0; i != kCount; ++i) {
+    high_bits |= ptr[i];
+  }
+  if (LIKELY(high_bits <= 0x7f)) {
+    for (size_t i = 0; i != kCount; ++i) {
+      out[i] = ptr[i];
+    }
+    *data = ptr + kCount;
+  } else {
+    for (size_t i = 0; i != kCount; ++i) {
+      out[i] = DecodeUnsignedLeb128(data);
+    }
+  }
+}
+
 static inline bool DecodeUnsignedLeb128Checked(const uint8_t** data,
                                                const void* end,
                                                uint32_t* out) {
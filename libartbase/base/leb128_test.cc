@@ -172,6 +172,38 @@ TEST(Leb128Test, UnsignedStream) {
   EXPECT_EQ(data_size, static_cast<size_t>(encoded_data_ptr - encoded_data));
 }
 
+TEST(Leb128Test, UnsignedBatch) {
+  // Decode the test values in groups of three, mixing single and multi-byte encodings.
+  uint8_t encoded_data[5 * arraysize(uleb128_tests)];
+  uint8_t* end = encoded_data;
+  for (size_t i = 0; i < arraysize(uleb128_tests); ++i) {
+    end = EncodeUnsignedLeb128(end, uleb128_tests[i].decoded);
+  }
+  const uint8_t* encoded_data_ptr = encoded_data;
+  size_t i = 0;
+  for (; i + 3u <= arraysize(uleb128_tests); i += 3u) {
+    uint32_t decoded[3];
+    DecodeUnsignedLeb128Batch<3u>(&encoded_data_ptr, decoded);
+    for (size_t j = 0; j < 3u; ++j) {
+      EXPECT_EQ(decoded[j], uleb128_tests[i + j].decoded) << " i = " << i << " j = " << j;
+    }
+  }
+  for (; i < arraysize(uleb128_tests); ++i) {
+    EXPECT_EQ(DecodeUnsignedLeb128(&encoded_data_ptr), uleb128_tests[i].decoded) << " i = " << i;
+  }
+  EXPECT_EQ(end, encoded_data_ptr);
+
+  // A batch of single-byte values.
+  static constexpr uint8_t kSmallValues[] = { 0x00, 0x01, 0x7f, 0x40 };
+  const uint8_t* small_ptr = kSmallValues;
+  uint32_t decoded[arraysize(kSmallValues)];
+  DecodeUnsignedLeb128Batch<arraysize(kSmallValues)>(&small_ptr, decoded);
+  for (size_t j = 0; j < arraysize(kSmallValues); ++j) {
+    EXPECT_EQ(decoded[j], kSmallValues[j]) << " j = " << j;
+  }
+  EXPECT_EQ(kSmallValues + arraysize(kSmallValues), small_ptr);
+}
+
 TEST(Leb128Test, SignedSinglesVector) {
   // Test individual encodings.
   for (size_t i = 0; i < arraysize(sleb128_tests); ++i) {
@@ -298,6 +330,23 @@ TEST(Leb128Test, Speed) {
     last_time = cur_time;
   }
 
+  // Measure batched decode speed over pairs of values, as in dex class data.
+  std::unique_ptr<Histogram<uint64_t>> batch_hist(
+      new Histogram<uint64_t>("Leb128BatchDecodeSpeedTest", 5));
+  encoded_data_ptr = &builder.GetData()[0];
+  last_time = NanoTime();
+  for (size_t i = 0; i < 1024; i++) {
+    for (size_t j = 0; j < 1024; j += 2) {
+      uint32_t decoded[2];
+      DecodeUnsignedLeb128Batch<2u>(&encoded_data_ptr, decoded);
+      EXPECT_EQ(decoded[0], (i * 1024) + j);
+      EXPECT_EQ(decoded[1], (i * 1024) + j + 1);
+    }
+    uint64_t cur_time = NanoTime();
+    batch_hist->AddValue(cur_time - last_time);
+    last_time = cur_time;
+  }
+
   Histogram<uint64_t>::CumulativeData enc_data;
   enc_hist->CreateHistogram(&enc_data);
   enc_hist->PrintConfidenceIntervals(std::cout, 0.99, enc_data);
@@ -305,6 +354,10 @@ TEST(Leb128Test, Speed) {
   Histogram<uint64_t>::CumulativeData dec_data;
   dec_hist->CreateHistogram(&dec_data);
   dec_hist->PrintConfidenceIntervals(std::cout, 0.99, dec_data);
+
+  Histogram<uint64_t>::CumulativeData batch_data;
+  batch_hist->CreateHistogram(&batch_data);
+  batch_hist->PrintConfidenceIntervals(std::cout, 0.99, batch_data);
 }
 
 }  // namespace art
@@ -111,6 +111,7 @@ Arena* MallocArenaPool::AllocArena(size_t size) {
       free_arenas_ = free_arenas_->next_;
     }
   }
+  RecordArenaAlloc(/*reused=*/ ret != nullptr);
   if (ret == nullptr) {
     ret = new MallocArena(size);
   }
@@ -77,6 +77,13 @@ Maps::iterator GetGMapsEntry(const MemMap& map) REQUIRES(MemMap::GetMemMapsLock(
   UNREACHABLE();
 }
 
+// Allocate a `gMaps` node for the given map without holding `mem_maps_lock_`. The node can
+// then be inserted with the lock held, keeping the allocation out of the critical section.
+static Maps::node_type MakeGMapsNode(MemMap* map) {
+  Maps temp;
+  return temp.extract(temp.emplace(map->BaseBegin(), map));
+}
+
 std::ostream& operator<<(std::ostream& os, const Maps& mem_maps) {
   os << "MemMap:" << std::endl;
   for (auto it = mem_maps.begin(); it != mem_maps.end(); ++it) {
@@ -629,13 +636,15 @@ void MemMap::ResetInForkedProcess() {
 void MemMap::Invalidate() {
   DCHECK(IsValid());
 
-  // Remove it from gMaps.
-  std::lock_guard<std::mutex> mu(*mem_maps_lock_);
-  auto it = GetGMapsEntry(*this);
-  gMaps->erase(it);
+  // Remove it from gMaps. The extracted node is freed after `mem_maps_lock_` is released.
+  Maps::node_type node;
+  {
+    std::lock_guard<std::mutex> mu(*mem_maps_lock_);
+    node = gMaps->extract(GetGMapsEntry(*this));
 
-  // Mark it as invalid.
-  base_size_ = 0u;
+    // Mark it as invalid.
+    base_size_ = 0u;
+  }
   DCHECK(!IsValid());
 }
 
@@ -689,9 +698,10 @@ MemMap::MemMap(const std::string& name, uint8_t* begin, size_t size, void* base_
     CHECK_NE(base_size_, 0U);
 
     // Add it to gMaps.
+    Maps::node_type node = MakeGMapsNode(this);
     std::lock_guard<std::mutex> mu(*mem_maps_lock_);
     DCHECK(gMaps != nullptr);
-    gMaps->insert(std::make_pair(base_begin_, this));
+    gMaps->insert(std::move(node));
   }
 }
 
@@ -758,11 +768,11 @@ MemMap MemMap::RemapAtEnd(uint8_t* new_end,
     PrintFileToLog("/proc/self/maps", LogSeverity::WARNING);
     return Invalid();
   }
-  // Update *this.
+  // Update *this. The extracted node is freed after `mem_maps_lock_` is released.
+  Maps::node_type node;
   if (new_base_size == 0u) {
     std::lock_guard<std::mutex> mu(*mem_maps_lock_);
-    auto it = GetGMapsEntry(*this);
-    gMaps->erase(it);
+    node = gMaps->extract(GetGMapsEntry(*this));
   }
 
   if (use_debug_name) {
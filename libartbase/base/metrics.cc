@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2020 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "metrics.h"
+
+#include <string.h>
+
+#include <ostream>
+#include <type_traits>
+
+namespace art {
+namespace metrics {
+
+namespace {
+
+template <typename T>
+void AppendValue(std::vector<uint8_t>* out, T value) {
+  static_assert(std::is_unsigned<T>::value, "Snapshot fields are unsigned");
+  // ART only runs on little-endian targets, so the in-memory representation is the file format.
+  const size_t offset = out->size();
+  out->resize(offset + sizeof(value));
+  memcpy(out->data() + offset, &value, sizeof(value));
+}
+
+constexpr uint32_t kDatumIds[] = {
+#define COUNTER(name, id) static_cast<uint32_t>(DatumId::k##name),
+  ART_COUNTERS(COUNTER)
+#undef COUNTER
+#define HISTOGRAM(name, id, num_buckets) static_cast<uint32_t>(DatumId::k##name),
+  ART_HISTOGRAMS(HISTOGRAM)
+#undef HISTOGRAM
+};
+
+constexpr bool AreDatumIdsUnique() {
+  for (size_t i = 0; i != arraysize(kDatumIds); ++i) {
+    for (size_t j = i + 1u; j != arraysize(kDatumIds); ++j) {
+      if (kDatumIds[i] == kDatumIds[j]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static_assert(AreDatumIdsUnique(), "Each datum needs its own id");
+
+#define COUNTER(name, id) static_assert((id) < 1000u, "Counter ids must be below 1000");
+ART_COUNTERS(COUNTER)
+#undef COUNTER
+#define HISTOGRAM(name, id, num_buckets) \
+  static_assert((id) >= 1000u, "Histogram ids must be at least 1000");
+ART_HISTOGRAMS(HISTOGRAM)
+#undef HISTOGRAM
+
+}  // namespace
+
+void ArtMetrics::DumpForSigQuit(std::ostream& os) const {
+  os << "Metrics:\n";
+#define COUNTER(name, id) os << "  " #name ": " << name##_.Value() << "\n";
+  ART_COUNTERS(COUNTER)
+#undef COUNTER
+#define HISTOGRAM(name, id, num_buckets)                                          \
+  os << "  " #name ":";                                                           \
+  for (size_t i = 0; i != num_buckets; ++i) {                                     \
+    if (name##_.GetBucket(i) != 0u) {                                             \
+      os << " " << name##_.BucketMinimumValue(i) << "+:" << name##_.GetBucket(i); \
+    }                                                                             \
+  }                                                                               \
+  os << "\n";
+  ART_HISTOGRAMS(HISTOGRAM)
+#undef HISTOGRAM
+}
+
+void ArtMetrics::WriteSnapshot(std::vector<uint8_t>* out) const {
+  uint32_t num_data = 0u;
+#define COUNTER(name, id) ++num_data;
+  ART_COUNTERS(COUNTER)
+#undef COUNTER
+#define HISTOGRAM(name, id, num_buckets) ++num_data;
+  ART_HISTOGRAMS(HISTOGRAM)
+#undef HISTOGRAM
+
+  AppendValue(out, kMagic);
+  AppendValue(out, kVersion);
+  AppendValue(out, num_data);
+#define COUNTER(name, id)                                    \
+  AppendValue(out, static_cast<uint32_t>(DatumId::k##name)); \
+  AppendValue(out, 1u);                                      \
+  AppendValue(out, name##_.Value());
+  ART_COUNTERS(COUNTER)
+#undef COUNTER
+#define HISTOGRAM(name, id, num_buckets)                     \
+  AppendValue(out, static_cast<uint32_t>(DatumId::k##name)); \
+  AppendValue(out, static_cast<uint32_t>(num_buckets));      \
+  for (size_t i = 0; i != num_buckets; ++i) {                \
+    AppendValue(out, name##_.GetBucket(i));                  \
+  }
+  ART_HISTOGRAMS(HISTOGRAM)
+#undef HISTOGRAM
+}
+
+}  // namespace metrics
+}  // namespace art
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2020 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ART_LIBARTBASE_BASE_METRICS_H_
+#define ART_LIBARTBASE_BASE_METRICS_H_
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iosfwd>
+#include <vector>
+
+#include "bit_utils.h"
+#include "macros.h"
+#include "time_utils.h"
+
+// COUNTER(name, id). The ids identify the data in the binary snapshot format and must never
+// change or be reused. Counters use ids from 0, histograms ids from 1000.
+#define ART_COUNTERS(COUNTER)                  \
+  COUNTER(ClassVerificationCount, 0)           \
+  COUNTER(ClassVerificationTotalTimeMicros, 1) \
+  COUNTER(JitMethodCompileCount, 2)            \
+  COUNTER(JitMethodCompileTotalTimeMicros, 3)  \
+  COUNTER(GcCollectionCount, 4)                \
+  COUNTER(GcTotalTimeMicros, 5)
+
+// HISTOGRAM(name, id, num_buckets), see MetricsHistogram for the bucket ranges. The last
+// bucket of the histograms below starts at about 4s, 0.5s and 0.5s respectively.
+#define ART_HISTOGRAMS(HISTOGRAM)                  \
+  HISTOGRAM(JitMethodCompileTimeMicros, 1000, 24)  \
+  HISTOGRAM(ClassVerificationTimeMicros, 1001, 21) \
+  HISTOGRAM(GcPauseTimeMicros, 1002, 21)
+
+namespace art {
+namespace metrics {
+
+// Stable identifiers for the metrics, used in the binary snapshot format.
+enum class DatumId : uint32_t {
+#define COUNTER(name, id) k##name = id,
+  ART_COUNTERS(COUNTER)
+#undef COUNTER
+#define HISTOGRAM(name, id, num_buckets) k##name = id,
+  ART_HISTOGRAMS(HISTOGRAM)
+#undef HISTOGRAM
+};
+
+// A counter that can be updated from any thread. Updates are single relaxed atomic adds, so
+// counters are cheap enough to keep enabled in release builds.
+class MetricsCounter {
+ public:
+  MetricsCounter() = default;
+
+  void AddOne() {
+    Add(1u);
+  }
+
+  void Add(uint64_t value) {
+    value_.fetch_add(value, std::memory_order_relaxed);
+  }
+
+  uint64_t Value() const {
+    return value_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<uint64_t> value_{0u};
+
+  DISALLOW_COPY_AND_ASSIGN(MetricsCounter);
+};
+
+// A histogram with `num_buckets` exponential buckets. Bucket 0 counts the value 0 and bucket
+// i > 0 counts values in [2^(i-1), 2^i), except that the last bucket also counts all larger
+// values. Durations span several orders of magnitude, which equal-width buckets cannot cover.
+template <size_t num_buckets>
+class MetricsHistogram {
+  static_assert(num_buckets >= 2u, "A histogram needs at least two buckets");
+  static_assert(num_buckets <= 65u, "Buckets past 2^64 can never be used");
+
+ public:
+  MetricsHistogram() = default;
+
+  void Add(uint64_t value) {
+    buckets_[FindBucketId(value)].fetch_add(1u, std::memory_order_relaxed);
+  }
+
+  static constexpr size_t NumBuckets() {
+    return num_buckets;
+  }
+
+  // The smallest value counted in the bucket.
+  static constexpr uint64_t BucketMinimumValue(size_t bucket_id) {
+    return (bucket_id == 0u) ? 0u : UINT64_C(1) << (bucket_id - 1u);
+  }
+
+  uint64_t GetBucket(size_t bucket_id) const {
+    return buckets_[bucket_id].load(std::memory_order_relaxed);
+  }
+
+ private:
+  static size_t FindBucketId(uint64_t value) {
+    return std::min(MinimumBitsToStore(value), num_buckets - 1u);
+  }
+
+  std::array<std::atomic<uint64_t>, num_buckets> buckets_{};
+
+  DISALLOW_COPY_AND_ASSIGN(MetricsHistogram);
+};
+
+// Adds the time spent in its scope, in microseconds, to a counter and optionally a histogram.
+template <typename Histogram>
+class ScopedMetricsTiming {
+ public:
+  ScopedMetricsTiming(MetricsCounter* total_time, Histogram* histogram)
+      : total_time_(total_time), histogram_(histogram), start_time_us_(MicroTime()) {}
+
+  ~ScopedMetricsTiming() {
+    const uint64_t duration_us = MicroTime() - start_time_us_;
+    total_time_->Add(duration_us);
+    if (histogram_ != nullptr) {
+      histogram_->Add(duration_us);
+    }
+  }
+
+ private:
+  MetricsCounter* const total_time_;
+  Histogram* const histogram_;
+  const uint64_t start_time_us_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScopedMetricsTiming);
+};
+
+// The set of runtime metrics. One instance is owned by the Runtime.
+class ArtMetrics {
+ public:
+  // Snapshot format: kMagic and kVersion as uint32_t, the number of data as uint32_t, then for
+  // each datum its DatumId and number of values as uint32_t followed by the values as uint64_t.
+  // A counter has one value, a histogram one value per bucket, in the order described by
+  // MetricsHistogram. All fields are little-endian.
+  static constexpr uint32_t kMagic = 0x4d545241u;  // "ARTM"
+  static constexpr uint32_t kVersion = 1u;
+
+  ArtMetrics() = default;
+
+#define COUNTER(name, id)  \
+  MetricsCounter* name() { \
+    return &name##_;       \
+  }
+  ART_COUNTERS(COUNTER)
+#undef COUNTER
+
+#define HISTOGRAM(name, id, num_buckets)  \
+  MetricsHistogram<num_buckets>* name() { \
+    return &name##_;                      \
+  }
+  ART_HISTOGRAMS(HISTOGRAM)
+#undef HISTOGRAM
+
+  void DumpForSigQuit(std::ostream& os) const;
+
+  // Append a binary snapshot of all metrics to `out`, see kMagic for the format.
+  void WriteSnapshot(std::vector<uint8_t>* out) const;
+
+ private:
+#define COUNTER(name, id) MetricsCounter name##_;
+  ART_COUNTERS(COUNTER)
+#undef COUNTER
+
+#define HISTOGRAM(name, id, num_buckets) MetricsHistogram<num_buckets> name##_;
+  ART_HISTOGRAMS(HISTOGRAM)
+#undef HISTOGRAM
+
+  DISALLOW_COPY_AND_ASSIGN(ArtMetrics);
+};
+
+}  // namespace metrics
+}  // namespace art
+
+#endif  // ART_LIBARTBASE_BASE_METRICS_H_
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2020 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "metrics.h"
+
+#include <string.h>
+
+#include <sstream>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace art {
+namespace metrics {
+
+TEST(MetricsTest, SimpleCounter) {
+  MetricsCounter counter;
+  EXPECT_EQ(0u, counter.Value());
+
+  counter.AddOne();
+  EXPECT_EQ(1u, counter.Value());
+
+  counter.Add(5);
+  EXPECT_EQ(6u, counter.Value());
+}
+
+TEST(MetricsTest, CounterConcurrentUpdates) {
+  static constexpr size_t kNumThreads = 4u;
+  static constexpr size_t kNumAdds = 10000u;
+  MetricsCounter counter;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&counter]() {
+      for (size_t j = 0; j < kNumAdds; ++j) {
+        counter.AddOne();
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(kNumThreads * kNumAdds, counter.Value());
+}
+
+TEST(MetricsTest, Histogram) {
+  MetricsHistogram<5> histogram;
+  histogram.Add(0);
+  histogram.Add(1);
+  histogram.Add(2);
+  histogram.Add(3);
+  histogram.Add(7);
+  histogram.Add(8);  // Beyond the range of the last bucket, counted in it.
+  histogram.Add(1000);
+
+  EXPECT_EQ(1u, histogram.GetBucket(0));
+  EXPECT_EQ(1u, histogram.GetBucket(1));
+  EXPECT_EQ(2u, histogram.GetBucket(2));
+  EXPECT_EQ(1u, histogram.GetBucket(3));
+  EXPECT_EQ(2u, histogram.GetBucket(4));
+
+  EXPECT_EQ(0u, histogram.BucketMinimumValue(0));
+  EXPECT_EQ(1u, histogram.BucketMinimumValue(1));
+  EXPECT_EQ(2u, histogram.BucketMinimumValue(2));
+  EXPECT_EQ(8u, histogram.BucketMinimumValue(4));
+}
+
+TEST(MetricsTest, ScopedTiming) {
+  MetricsCounter total_time;
+  MetricsHistogram<2> histogram;
+  {
+    ScopedMetricsTiming<decltype(histogram)> timing(&total_time, &histogram);
+  }
+  EXPECT_EQ(1u, histogram.GetBucket(0) + histogram.GetBucket(1));
+}
+
+// The ids are part of the snapshot format and must not change.
+TEST(MetricsTest, DatumIds) {
+  EXPECT_EQ(0u, static_cast<uint32_t>(DatumId::kClassVerificationCount));
+  EXPECT_EQ(1u, static_cast<uint32_t>(DatumId::kClassVerificationTotalTimeMicros));
+  EXPECT_EQ(2u, static_cast<uint32_t>(DatumId::kJitMethodCompileCount));
+  EXPECT_EQ(3u, static_cast<uint32_t>(DatumId::kJitMethodCompileTotalTimeMicros));
+  EXPECT_EQ(4u, static_cast<uint32_t>(DatumId::kGcCollectionCount));
+  EXPECT_EQ(5u, static_cast<uint32_t>(DatumId::kGcTotalTimeMicros));
+  EXPECT_EQ(1000u, static_cast<uint32_t>(DatumId::kJitMethodCompileTimeMicros));
+  EXPECT_EQ(1001u, static_cast<uint32_t>(DatumId::kClassVerificationTimeMicros));
+  EXPECT_EQ(1002u, static_cast<uint32_t>(DatumId::kGcPauseTimeMicros));
+}
+
+TEST(MetricsTest, Snapshot) {
+  ArtMetrics metrics;
+  metrics.GcCollectionCount()->Add(3);
+  metrics.GcPauseTimeMicros()->Add(5);
+
+  std::vector<uint8_t> snapshot;
+  metrics.WriteSnapshot(&snapshot);
+
+  size_t offset = 0u;
+  auto read_u32 = [&]() {
+    uint32_t value;
+    EXPECT_LE(offset + sizeof(value), snapshot.size());
+    memcpy(&value, snapshot.data() + offset, sizeof(value));
+    offset += sizeof(value);
+    return value;
+  };
+  auto read_u64 = [&]() {
+    uint64_t value;
+    EXPECT_LE(offset + sizeof(value), snapshot.size());
+    memcpy(&value, snapshot.data() + offset, sizeof(value));
+    offset += sizeof(value);
+    return value;
+  };
+
+  EXPECT_EQ(ArtMetrics::kMagic, read_u32());
+  EXPECT_EQ(ArtMetrics::kVersion, read_u32());
+  const uint32_t num_data = read_u32();
+  bool found_counter = false;
+  bool found_histogram = false;
+  for (uint32_t i = 0; i < num_data; ++i) {
+    const DatumId id = static_cast<DatumId>(read_u32());
+    const uint32_t num_values = read_u32();
+    uint64_t total = 0u;
+    for (uint32_t j = 0; j < num_values; ++j) {
+      total += read_u64();
+    }
+    if (id == DatumId::kGcCollectionCount) {
+      EXPECT_EQ(1u, num_values);
+      EXPECT_EQ(3u, total);
+      found_counter = true;
+    } else if (id == DatumId::kGcPauseTimeMicros) {
+      EXPECT_EQ(metrics.GcPauseTimeMicros()->NumBuckets(), num_values);
+      EXPECT_EQ(1u, total);
+      found_histogram = true;
+    } else {
+      EXPECT_EQ(0u, total);
+    }
+  }
+  EXPECT_TRUE(found_counter);
+  EXPECT_TRUE(found_histogram);
+  EXPECT_EQ(snapshot.size(), offset);
+}
+
+TEST(MetricsTest, Dump) {
+  ArtMetrics metrics;
+  metrics.JitMethodCompileCount()->Add(7);
+  std::ostringstream oss;
+  metrics.DumpForSigQuit(oss);
+  EXPECT_NE(std::string::npos, oss.str().find("JitMethodCompileCount: 7\n"));
+}
+
+}  // namespace metrics
+}  // namespace art
@@ -84,6 +84,12 @@ MemMap ZipEntry::ExtractToMemMap(const char* zip_filename,
     return MemMap::Invalid();
   }
 
+#ifdef MADV_POPULATE_WRITE
+  // Extraction writes every page of the map front to back. Populate them all up front rather
+  // than taking a page fault per page; this is best effort and fails on kernels before 5.14.
+  madvise(map.Begin(), map.Size(), MADV_POPULATE_WRITE);
+#endif
+
   const int32_t error = ExtractToMemory(handle_, zip_entry_, map.Begin(), map.Size());
   if (error) {
     *error_msg = std::string(ErrorCodeString(error));
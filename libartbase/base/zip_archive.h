@@ -52,7 +52,8 @@ class ZipEntry {
   //   the original file that the ZipArchive was open with is used
   //   for the mapping.
   //
-  // Will only succeed if the entry is stored uncompressed.
+  // Will only succeed if the entry is stored uncompressed. The entry does not need to be page
+  // aligned, the containing pages are mapped and the returned map begins at the entry data.
   // Returns invalid MemMap on failure and sets error_msg.
   MemMap MapDirectlyFromFile(const char* zip_filename, /*out*/std::string* error_msg);
   virtual ~ZipEntry();
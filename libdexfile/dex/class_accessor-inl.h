@@ -79,8 +79,12 @@ inline MethodReference ClassAccessor::Method::GetReference() const {
 
 
 inline void ClassAccessor::Field::Read() {
-  index_ += DecodeUnsignedLeb128(&ptr_pos_);
-  access_flags_ = DecodeUnsignedLeb128(&ptr_pos_);
+  // Unlike method flags (e.g. kAccConstructor), field access flags are usually single-byte
+  // values, as is the index delta.
+  uint32_t index_delta_and_flags[2];
+  DecodeUnsignedLeb128Batch<2u>(&ptr_pos_, index_delta_and_flags);
+  index_ += index_delta_and_flags[0];
+  access_flags_ = index_delta_and_flags[1];
   if (hiddenapi_ptr_pos_ != nullptr) {
     hiddenapi_flags_ = DecodeUnsignedLeb128(&hiddenapi_ptr_pos_);
     DCHECK(hiddenapi::ApiList(hiddenapi_flags_).IsValid());
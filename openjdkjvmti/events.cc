@@ -1584,12 +1584,57 @@ jvmtiError EventHandler::SetEvent(ArtJvmTiEnv* env,
   if (new_state != old_state) {
     HandleEventType(event, mode == JVMTI_ENABLE);
   }
+  if (thread == nullptr &&
+      (event == ArtJvmtiEvent::kFieldAccess || event == ArtJvmtiEvent::kFieldModification)) {
+    return UpdateFieldWatchDeopt(event);
+  }
   if (old_thread_state != new_thread_state) {
     return HandleEventDeopt(event, thread, new_thread_state);
   }
   return OK;
 }
 
+bool EventHandler::AnyFieldWatchesLocked(ArtJvmtiEvent event) {
+  art::Thread* self = art::Thread::Current();
+  for (ArtJvmTiEnv* env : envs) {
+    if (env == nullptr) {
+      continue;
+    }
+    art::ReaderMutexLock ei_mu(self, env->event_info_mutex_);
+    const std::unordered_set<art::ArtField*>& watched =
+        (event == ArtJvmtiEvent::kFieldAccess) ? env->access_watched_fields
+                                               : env->modify_watched_fields;
+    if (!watched.empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+jvmtiError EventHandler::UpdateFieldWatchDeopt(ArtJvmtiEvent event) {
+  DCHECK(event == ArtJvmtiEvent::kFieldAccess || event == ArtJvmtiEvent::kFieldModification);
+  art::Thread* self = art::Thread::Current();
+  bool needs_deopt;
+  {
+    art::ScopedObjectAccess soa(self);
+    art::WriterMutexLock el_mu(self, envs_lock_);
+    art::MutexLock tll_mu(self, *art::Locks::thread_list_lock_);
+    needs_deopt = GetThreadEventState(event, nullptr) && AnyFieldWatchesLocked(event);
+  }
+  bool& deopt_held = (event == ArtJvmtiEvent::kFieldAccess) ? field_access_deopt_held_
+                                                            : field_modification_deopt_held_;
+  if (deopt_held == needs_deopt) {
+    return OK;
+  }
+  deopt_held = needs_deopt;
+  return HandleEventDeopt(event, /*thread=*/ nullptr, needs_deopt);
+}
+
+void EventHandler::HandleFieldWatchesChanged(ArtJvmtiEvent event) {
+  ScopedNoUserCodeSuspension snucs(art::Thread::Current());
+  UpdateFieldWatchDeopt(event);
+}
+
 bool EventHandler::GetThreadEventState(ArtJvmtiEvent event, art::Thread* thread) {
   for (ArtJvmTiEnv* stored_env : envs) {
     if (stored_env == nullptr) {
@@ -1671,6 +1716,8 @@ void EventHandler::Shutdown() {
 EventHandler::EventHandler()
   : envs_lock_("JVMTI Environment List Lock", art::LockLevel::kPostMutatorTopLockLevel),
     frame_pop_enabled(false),
+    field_access_deopt_held_(false),
+    field_modification_deopt_held_(false),
     internal_event_refcount_({0}) {
   alloc_listener_.reset(new JvmtiEventAllocationListener(this));
   AllocationManager::Get()->SetAllocListener(alloc_listener_.get());
@@ -303,6 +303,11 @@ class EventHandler {
   inline void DispatchEventOnEnv(ArtJvmTiEnv* env, art::Thread* thread, Args... args) const
       REQUIRES(!envs_lock_);
 
+  // Tell the event handler that the set of fields watched for the given field access or
+  // modification event changed in some jvmtiEnv.
+  void HandleFieldWatchesChanged(ArtJvmtiEvent event)
+      REQUIRES(!envs_lock_, !art::Locks::mutator_lock_);
+
   void AddDelayedNonStandardExitEvent(const art::ShadowFrame* frame, bool is_object, jvalue val)
       REQUIRES_SHARED(art::Locks::mutator_lock_)
       REQUIRES(art::Locks::user_code_suspension_lock_, art::Locks::thread_list_lock_);
@@ -396,6 +401,13 @@ class EventHandler {
   void HandleLocalAccessCapabilityAdded();
   void HandleBreakpointEventsChanged(bool enable);
 
+  // Returns whether any jvmtiEnv watches a field for the given field event.
+  bool AnyFieldWatchesLocked(ArtJvmtiEvent event) REQUIRES_SHARED(envs_lock_);
+  // Globally enabled field events only need everything to be deoptimized while at least one field
+  // is actually watched. Acquire or release that deoptimization to match the current state.
+  jvmtiError UpdateFieldWatchDeopt(ArtJvmtiEvent event)
+      REQUIRES(art::Locks::user_code_suspension_lock_, !envs_lock_);
+
   bool OtherMonitorEventsEnabledAnywhere(ArtJvmtiEvent event);
 
   int32_t GetInternalEventRefcount(ArtJvmtiEvent event) const REQUIRES(envs_lock_);
@@ -437,6 +449,10 @@ class EventHandler {
   // TODO We could remove the listeners once all jvmtiEnvs have drained their shadow-frame vectors.
   bool frame_pop_enabled;
 
+  // Whether the global deoptimization for field access/modification events is currently held.
+  bool field_access_deopt_held_ GUARDED_BY(art::Locks::user_code_suspension_lock_);
+  bool field_modification_deopt_held_ GUARDED_BY(art::Locks::user_code_suspension_lock_);
+
   // The overall refcount for each internal event across all threads.
   std::array<int32_t, kInternalEventCount> internal_event_refcount_ GUARDED_BY(envs_lock_);
   // The refcount for each thread for each internal event.
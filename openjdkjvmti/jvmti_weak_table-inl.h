@@ -212,7 +212,8 @@ template <typename Updater, typename JvmtiWeakTable<T>::TableUpdateNullTarget kT
 ALWAYS_INLINE inline void JvmtiWeakTable<T>::UpdateTableWith(Updater& updater) {
   // We optimistically hope that elements will still be well-distributed when re-inserting them.
   // So play with the map mechanics, and postpone rehashing. This avoids the need of a side
-  // vector and two passes.
+  // vector and two passes. Moved objects are re-keyed by extracting and re-inserting their node,
+  // so that a moving GC does not free and allocate a node for every tagged object.
   float original_max_load_factor = tagged_objects_.max_load_factor();
   tagged_objects_.max_load_factor(std::numeric_limits<float>::max());
   // For checking that a max load-factor actually does what we expect.
@@ -226,15 +227,15 @@ ALWAYS_INLINE inline void JvmtiWeakTable<T>::UpdateTableWith(Updater& updater) {
       if (kTargetNull == kIgnoreNull && target_obj == nullptr) {
         // Ignore null target, don't do anything.
       } else {
-        T tag = it->second;
-        it = tagged_objects_.erase(it);
+        auto node = tagged_objects_.extract(it++);
         if (target_obj != nullptr) {
-          tagged_objects_.emplace(art::GcRoot<art::mirror::Object>(target_obj), tag);
+          node.key() = art::GcRoot<art::mirror::Object>(target_obj);
+          tagged_objects_.insert(std::move(node));
           DCHECK_EQ(original_bucket_count, tagged_objects_.bucket_count());
         } else if (kTargetNull == kCallHandleNull) {
-          HandleNullSweep(tag);
+          HandleNullSweep(node.mapped());
         }
-        continue;  // Iterator was implicitly updated by erase.
+        continue;  // Iterator was already advanced before extracting the node.
       }
     }
     it++;
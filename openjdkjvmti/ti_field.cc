@@ -108,7 +108,10 @@ struct FieldReflectiveValueCallback : public art::ReflectiveValueVisitCallback {
 
 static FieldReflectiveValueCallback gReflectiveValueCallback;
 
+EventHandler* FieldUtil::gEventHandler = nullptr;
+
 void FieldUtil::Register(EventHandler* eh) {
+  gEventHandler = eh;
   gReflectiveValueCallback.event_handler = eh;
   art::ScopedThreadStateChange stsc(art::Thread::Current(),
                                     art::ThreadState::kWaitingForDebuggerToAttach);
@@ -270,69 +273,81 @@ jvmtiError FieldUtil::IsFieldSynthetic(jvmtiEnv* env ATTRIBUTE_UNUSED,
 
 jvmtiError FieldUtil::SetFieldModificationWatch(jvmtiEnv* jenv, jclass klass, jfieldID field) {
   ArtJvmTiEnv* env = ArtJvmTiEnv::AsArtJvmTiEnv(jenv);
-  art::WriterMutexLock lk(art::Thread::Current(), env->event_info_mutex_);
   if (klass == nullptr) {
     return ERR(INVALID_CLASS);
   }
   if (field == nullptr) {
     return ERR(INVALID_FIELDID);
   }
-  auto res_pair = env->modify_watched_fields.insert(art::jni::DecodeArtField(field));
-  if (!res_pair.second) {
-    // Didn't get inserted because it's already present!
-    return ERR(DUPLICATE);
+  {
+    art::WriterMutexLock lk(art::Thread::Current(), env->event_info_mutex_);
+    auto res_pair = env->modify_watched_fields.insert(art::jni::DecodeArtField(field));
+    if (!res_pair.second) {
+      // Didn't get inserted because it's already present!
+      return ERR(DUPLICATE);
+    }
   }
+  gEventHandler->HandleFieldWatchesChanged(ArtJvmtiEvent::kFieldModification);
   return OK;
 }
 
 jvmtiError FieldUtil::ClearFieldModificationWatch(jvmtiEnv* jenv, jclass klass, jfieldID field) {
   ArtJvmTiEnv* env = ArtJvmTiEnv::AsArtJvmTiEnv(jenv);
-  art::WriterMutexLock lk(art::Thread::Current(), env->event_info_mutex_);
   if (klass == nullptr) {
     return ERR(INVALID_CLASS);
   }
   if (field == nullptr) {
     return ERR(INVALID_FIELDID);
   }
-  auto pos = env->modify_watched_fields.find(art::jni::DecodeArtField(field));
-  if (pos == env->modify_watched_fields.end()) {
-    return ERR(NOT_FOUND);
+  {
+    art::WriterMutexLock lk(art::Thread::Current(), env->event_info_mutex_);
+    auto pos = env->modify_watched_fields.find(art::jni::DecodeArtField(field));
+    if (pos == env->modify_watched_fields.end()) {
+      return ERR(NOT_FOUND);
+    }
+    env->modify_watched_fields.erase(pos);
   }
-  env->modify_watched_fields.erase(pos);
+  gEventHandler->HandleFieldWatchesChanged(ArtJvmtiEvent::kFieldModification);
   return OK;
 }
 
 jvmtiError FieldUtil::SetFieldAccessWatch(jvmtiEnv* jenv, jclass klass, jfieldID field) {
   ArtJvmTiEnv* env = ArtJvmTiEnv::AsArtJvmTiEnv(jenv);
-  art::WriterMutexLock lk(art::Thread::Current(), env->event_info_mutex_);
   if (klass == nullptr) {
     return ERR(INVALID_CLASS);
   }
   if (field == nullptr) {
     return ERR(INVALID_FIELDID);
   }
-  auto res_pair = env->access_watched_fields.insert(art::jni::DecodeArtField(field));
-  if (!res_pair.second) {
-    // Didn't get inserted because it's already present!
-    return ERR(DUPLICATE);
+  {
+    art::WriterMutexLock lk(art::Thread::Current(), env->event_info_mutex_);
+    auto res_pair = env->access_watched_fields.insert(art::jni::DecodeArtField(field));
+    if (!res_pair.second) {
+      // Didn't get inserted because it's already present!
+      return ERR(DUPLICATE);
+    }
   }
+  gEventHandler->HandleFieldWatchesChanged(ArtJvmtiEvent::kFieldAccess);
   return OK;
 }
 
 jvmtiError FieldUtil::ClearFieldAccessWatch(jvmtiEnv* jenv, jclass klass, jfieldID field) {
   ArtJvmTiEnv* env = ArtJvmTiEnv::AsArtJvmTiEnv(jenv);
-  art::WriterMutexLock lk(art::Thread::Current(), env->event_info_mutex_);
   if (klass == nullptr) {
     return ERR(INVALID_CLASS);
   }
   if (field == nullptr) {
     return ERR(INVALID_FIELDID);
   }
-  auto pos = env->access_watched_fields.find(art::jni::DecodeArtField(field));
-  if (pos == env->access_watched_fields.end()) {
-    return ERR(NOT_FOUND);
+  {
+    art::WriterMutexLock lk(art::Thread::Current(), env->event_info_mutex_);
+    auto pos = env->access_watched_fields.find(art::jni::DecodeArtField(field));
+    if (pos == env->access_watched_fields.end()) {
+      return ERR(NOT_FOUND);
+    }
+    env->access_watched_fields.erase(pos);
   }
-  env->access_watched_fields.erase(pos);
+  gEventHandler->HandleFieldWatchesChanged(ArtJvmtiEvent::kFieldAccess);
   return OK;
 }
 
@@ -74,6 +74,9 @@ class FieldUtil {
 
   static void Register(EventHandler* eh);
   static void Unregister();
+
+ private:
+  static EventHandler* gEventHandler;
 };
 
 }  // namespace openjdkjvmti
@@ -1712,23 +1712,14 @@ bool CompareClasses(art::ObjPtr<art::mirror::Class> l, art::ObjPtr<art::mirror::
 }
 
 bool Redefiner::ClassRedefinition::CollectAndCreateNewInstances(
+    const std::vector<art::Handle<art::mirror::Object>>& old_instances,
     /*out*/ RedefinitionDataIter* cur_data) {
   if (!cur_data->IsInitialStructural()) {
     // An earlier structural redefinition already remade all the instances.
+    DCHECK(old_instances.empty());
     return true;
   }
-  art::gc::Heap* heap = driver_->runtime_->GetHeap();
-  art::VariableSizedHandleScope hs(driver_->self_);
-  art::Handle<art::mirror::Class> old_klass(hs.NewHandle(cur_data->GetMirrorClass()));
-  std::vector<art::Handle<art::mirror::Object>> old_instances;
-  auto is_instance = [&](art::mirror::Object* obj) REQUIRES_SHARED(art::Locks::mutator_lock_) {
-    return obj->InstanceOf(old_klass.Get());
-  };
-  heap->VisitObjects([&](art::mirror::Object* obj) REQUIRES_SHARED(art::Locks::mutator_lock_) {
-    if (is_instance(obj)) {
-      old_instances.push_back(hs.NewHandle(obj));
-    }
-  });
+  art::StackHandleScope<5> hs(driver_->self_);
   VLOG(plugin) << "Collected " << old_instances.size() << " instances to recreate!";
   art::Handle<art::mirror::ObjectArray<art::mirror::Class>> old_classes_arr(
       hs.NewHandle(cur_data->GetOldClasses()));
@@ -2202,9 +2193,31 @@ bool Redefiner::EnsureAllClassAllocationsFinished(RedefinitionDataHolder& holder
 }
 
 bool Redefiner::CollectAndCreateNewInstances(RedefinitionDataHolder& holder) {
+  // Find the instances of every structurally redefined class in a single heap walk rather than
+  // walking the heap once per class.
+  art::VariableSizedHandleScope hs(self_);
+  std::vector<std::pair<int32_t, art::Handle<art::mirror::Class>>> structural_classes;
+  for (RedefinitionDataIter data = holder.begin(); data != holder.end(); ++data) {
+    if (data.IsInitialStructural()) {
+      structural_classes.emplace_back(data.GetIndex(), hs.NewHandle(data.GetMirrorClass()));
+    }
+  }
+  std::vector<std::vector<art::Handle<art::mirror::Object>>> old_instances(redefinitions_.size());
+  if (!structural_classes.empty()) {
+    runtime_->GetHeap()->VisitObjects(
+        [&](art::mirror::Object* obj) REQUIRES_SHARED(art::Locks::mutator_lock_) {
+          for (const auto& [idx, klass] : structural_classes) {
+            if (obj->InstanceOf(klass.Get())) {
+              old_instances[idx].push_back(hs.NewHandle(obj));
+              break;
+            }
+          }
+        });
+  }
   for (RedefinitionDataIter data = holder.begin(); data != holder.end(); ++data) {
     // Allocate the data this redefinition requires.
-    if (!data.GetRedefinition().CollectAndCreateNewInstances(&data)) {
+    if (!data.GetRedefinition().CollectAndCreateNewInstances(old_instances[data.GetIndex()],
+                                                             &data)) {
       return false;
     }
   }
@@ -175,7 +175,11 @@ class Redefiner {
     bool FinishNewClassAllocations(RedefinitionDataHolder& holder,
                                    /*out*/RedefinitionDataIter* cur_data)
         REQUIRES_SHARED(art::Locks::mutator_lock_);
-    bool CollectAndCreateNewInstances(/*out*/RedefinitionDataIter* cur_data)
+    // Allocates the replacement objects for `old_instances`, the instances of the redefined class
+    // and its subtypes.
+    bool CollectAndCreateNewInstances(
+        const std::vector<art::Handle<art::mirror::Object>>& old_instances,
+        /*out*/RedefinitionDataIter* cur_data)
         REQUIRES_SHARED(art::Locks::mutator_lock_);
 
     bool AllocateAndRememberNewDexFileCookie(
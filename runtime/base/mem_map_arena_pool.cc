@@ -31,6 +31,8 @@
 
 namespace art {
 
+static constexpr size_t kHugePageSize = 2 * MB;
+
 class MemMapArena final : public Arena {
  public:
   MemMapArena(size_t size, bool low_4gb, const char* name);
@@ -63,6 +65,13 @@ MemMap MemMapArena::Allocate(size_t size, bool low_4gb, const char* name) {
                                     low_4gb,
                                     &error_msg);
   CHECK(map.IsValid()) << error_msg;
+#ifdef MADV_HUGEPAGE
+  // Arenas that can hold a whole huge page (oversized requests from the compiler) are touched
+  // front to back; let the kernel back them with huge pages to cut the first-touch faults.
+  if (size >= kHugePageSize) {
+    madvise(map.Begin(), map.Size(), MADV_HUGEPAGE);
+  }
+#endif
   return map;
 }
 
@@ -110,6 +119,7 @@ Arena* MemMapArenaPool::AllocArena(size_t size) {
       free_arenas_ = free_arenas_->next_;
     }
   }
+  RecordArenaAlloc(/*reused=*/ ret != nullptr);
   if (ret == nullptr) {
     ret = new MemMapArena(size, low_4gb_, name_);
   }
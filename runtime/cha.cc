@@ -16,6 +16,8 @@
 
 #include "cha.h"
 
+#include <atomic>
+
 #include "art_method-inl.h"
 #include "base/logging.h"  // For VLOG
 #include "base/mutex.h"
@@ -188,7 +190,12 @@ class CHAStackVisitor final  : public StackVisitor {
                   Context* context,
                   const std::unordered_set<OatQuickMethodHeader*>& method_headers)
       : StackVisitor(thread_in, context, StackVisitor::StackWalkKind::kSkipInlinedFrames),
-        method_headers_(method_headers) {
+        method_headers_(method_headers),
+        num_deoptimized_frames_(0u) {
+  }
+
+  size_t GetNumDeoptimizedFrames() const {
+    return num_deoptimized_frames_;
   }
 
   bool VisitFrame() override REQUIRES_SHARED(Locks::mutator_lock_) {
@@ -212,14 +219,16 @@ class CHAStackVisitor final  : public StackVisitor {
       // This compiled version doesn't have should_deoptimize flag. Skip.
       return true;
     }
-    auto it = std::find(method_headers_.begin(), method_headers_.end(), method_header);
-    if (it == method_headers_.end()) {
+    // Note: `method_header` is const but the set holds non-const pointers.
+    if (method_headers_.find(const_cast<OatQuickMethodHeader*>(method_header)) ==
+            method_headers_.end()) {
       // Not in the list of method headers that should be deoptimized.
       return true;
     }
 
     // The compiled code on stack is not valid anymore. Need to deoptimize.
     SetShouldDeoptimizeFlag();
+    ++num_deoptimized_frames_;
 
     return true;
   }
@@ -242,6 +251,8 @@ class CHAStackVisitor final  : public StackVisitor {
 
   // Set of method headers for compiled code that should be deoptimized.
   const std::unordered_set<OatQuickMethodHeader*>& method_headers_;
+  // Number of frames that had their should_deoptimize flag set.
+  size_t num_deoptimized_frames_;
 
   DISALLOW_COPY_AND_ASSIGN(CHAStackVisitor);
 };
@@ -250,7 +261,8 @@ class CHACheckpoint final : public Closure {
  public:
   explicit CHACheckpoint(const std::unordered_set<OatQuickMethodHeader*>& method_headers)
       : barrier_(0),
-        method_headers_(method_headers) {}
+        method_headers_(method_headers),
+        num_deoptimized_frames_(0u) {}
 
   void Run(Thread* thread) override {
     // Note thread and self may not be equal if thread was already suspended at
@@ -259,9 +271,16 @@ class CHACheckpoint final : public Closure {
     ScopedObjectAccess soa(self);
     CHAStackVisitor visitor(thread, nullptr, method_headers_);
     visitor.WalkStack();
+    num_deoptimized_frames_.fetch_add(visitor.GetNumDeoptimizedFrames(),
+                                      std::memory_order_relaxed);
     barrier_.Pass(self);
   }
 
+  // Only valid once all threads have run through the checkpoint.
+  size_t GetNumDeoptimizedFrames() const {
+    return num_deoptimized_frames_.load(std::memory_order_relaxed);
+  }
+
   void WaitForThreadsToRunThroughCheckpoint(size_t threads_running_checkpoint) {
     Thread* self = Thread::Current();
     ScopedThreadStateChange tsc(self, kWaitingForCheckPointsToRun);
@@ -273,6 +292,8 @@ class CHACheckpoint final : public Closure {
   Barrier barrier_;
   // List of method headers for invalidated compiled code.
   const std::unordered_set<OatQuickMethodHeader*>& method_headers_;
+  // Number of frames marked for deoptimization, summed over all threads.
+  std::atomic<size_t> num_deoptimized_frames_;
 
   DISALLOW_COPY_AND_ASSIGN(CHACheckpoint);
 };
@@ -653,6 +674,7 @@ void ClassHierarchyAnalysis::InvalidateSingleImplementationMethods(
             continue;
           }
           invalidated->SetHasSingleImplementation(false);
+          ++num_invalidated_methods_;
           if (invalidated->IsAbstract()) {
             // Clear the single implementation method.
             invalidated->SetSingleImplementation(nullptr, image_pointer_size);
@@ -676,6 +698,7 @@ void ClassHierarchyAnalysis::InvalidateSingleImplementationMethods(
             headers.push_back({method, method_header});
             dependent_method_headers.insert(method_header);
           }
+          num_invalidated_compiled_code_ += GetDependents(invalidated).size();
           RemoveAllDependenciesFor(invalidated);
         }
       }
@@ -701,9 +724,20 @@ void ClassHierarchyAnalysis::InvalidateSingleImplementationMethods(
     if (threads_running_checkpoint != 0) {
       checkpoint.WaitForThreadsToRunThroughCheckpoint(threads_running_checkpoint);
     }
+    MutexLock cha_mu(self, *Locks::cha_lock_);
+    ++num_checkpoints_;
+    num_deoptimized_frames_ += checkpoint.GetNumDeoptimizedFrames();
   }
 }
 
+void ClassHierarchyAnalysis::DumpForSigQuit(std::ostream& os) {
+  MutexLock mu(Thread::Current(), *Locks::cha_lock_);
+  os << "CHA invalidated single-implementation methods=" << num_invalidated_methods_
+     << " compiled code=" << num_invalidated_compiled_code_
+     << " checkpoints=" << num_checkpoints_
+     << " deoptimized frames=" << num_deoptimized_frames_ << "\n";
+}
+
 void ClassHierarchyAnalysis::RemoveDependenciesForLinearAlloc(const LinearAlloc* linear_alloc) {
   MutexLock mu(Thread::Current(), *Locks::cha_lock_);
   for (auto it = cha_dependency_map_.begin(); it != cha_dependency_map_.end(); ) {
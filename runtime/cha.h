@@ -17,6 +17,7 @@
 #ifndef ART_RUNTIME_CHA_H_
 #define ART_RUNTIME_CHA_H_
 
+#include <iosfwd>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -129,6 +130,9 @@ class ClassHierarchyAnalysis {
   void RemoveDependenciesForLinearAlloc(const LinearAlloc* linear_alloc)
       REQUIRES(!Locks::cha_lock_);
 
+  // Dump statistics about invalidated single-implementation assumptions.
+  void DumpForSigQuit(std::ostream& os) REQUIRES(!Locks::cha_lock_);
+
  private:
   void InitSingleImplementationFlag(Handle<mirror::Class> klass,
                                     ArtMethod* method,
@@ -171,6 +175,15 @@ class ClassHierarchyAnalysis {
   std::unordered_map<ArtMethod*, ListOfDependentPairs> cha_dependency_map_
     GUARDED_BY(Locks::cha_lock_);
 
+  // Statistics, see DumpForSigQuit().
+  // Number of methods that lost their single-implementation status.
+  size_t num_invalidated_methods_ GUARDED_BY(Locks::cha_lock_) = 0u;
+  // Number of compiled code dependencies invalidated as a result.
+  size_t num_invalidated_compiled_code_ GUARDED_BY(Locks::cha_lock_) = 0u;
+  // Number of deoptimization checkpoints run, and frames they marked for deoptimization.
+  size_t num_checkpoints_ GUARDED_BY(Locks::cha_lock_) = 0u;
+  size_t num_deoptimized_frames_ GUARDED_BY(Locks::cha_lock_) = 0u;
+
   DISALLOW_COPY_AND_ASSIGN(ClassHierarchyAnalysis);
 };
 
@@ -4740,6 +4740,10 @@ verifier::FailureKind ClassLinker::VerifyClass(
   std::string error_msg;
   verifier::FailureKind verifier_failure = verifier::FailureKind::kNoFailure;
   if (!preverified) {
+    metrics::ArtMetrics* metrics = Runtime::Current()->GetMetrics();
+    metrics::ScopedMetricsTiming timing(metrics->ClassVerificationTotalTimeMicros(),
+                                        metrics->ClassVerificationTimeMicros());
+    metrics->ClassVerificationCount()->AddOne();
     verifier_failure = PerformClassVerification(self, klass, log_level, &error_msg);
   }
 
@@ -9464,6 +9468,9 @@ void ClassLinker::SetEntryPointsForObsoleteMethod(ArtMethod* method) const {
 
 void ClassLinker::DumpForSigQuit(std::ostream& os) {
   ScopedObjectAccess soa(Thread::Current());
+  if (cha_ != nullptr) {
+    cha_->DumpForSigQuit(os);
+  }
   ReaderMutexLock mu(soa.Self(), *Locks::classlinker_classes_lock_);
   os << "Zygote loaded classes=" << NumZygoteClasses() << " post zygote classes="
      << NumNonZygoteClasses() << "\n";
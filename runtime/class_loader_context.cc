@@ -64,12 +64,14 @@ ClassLoaderContext::ClassLoaderContext()
     : special_shared_library_(false),
       dex_files_open_attempted_(false),
       dex_files_open_result_(false),
+      only_read_checksums_(false),
       owns_the_dex_files_(true) {}
 
 ClassLoaderContext::ClassLoaderContext(bool owns_the_dex_files)
     : special_shared_library_(false),
       dex_files_open_attempted_(true),
       dex_files_open_result_(true),
+      only_read_checksums_(false),
       owns_the_dex_files_(owns_the_dex_files) {}
 
 // Utility method to add parent and shared libraries of `info` into
@@ -402,7 +404,8 @@ ClassLoaderContext::ClassLoaderInfo* ClassLoaderContext::ParseInternal(
 // been stripped, this opens them from their oat files (which get added to opened_oat_files).
 bool ClassLoaderContext::OpenDexFiles(InstructionSet isa,
                                       const std::string& classpath_dir,
-                                      const std::vector<int>& fds) {
+                                      const std::vector<int>& fds,
+                                      bool only_read_checksums) {
   if (dex_files_open_attempted_) {
     // Do not attempt to re-open the files if we already tried.
     return dex_files_open_result_;
@@ -411,6 +414,7 @@ bool ClassLoaderContext::OpenDexFiles(InstructionSet isa,
   dex_files_open_attempted_ = true;
   // Assume we can open all dex files. If not, we will set this to false as we go.
   dex_files_open_result_ = true;
+  only_read_checksums_ = only_read_checksums;
 
   if (special_shared_library_) {
     // Nothing to open if the context is a special shared library.
@@ -431,7 +435,17 @@ bool ClassLoaderContext::OpenDexFiles(InstructionSet isa,
     work_list.pop_back();
     DCHECK(info->type != kInMemoryDexClassLoader) << __FUNCTION__ << " not supported for IMC";
 
-    size_t opened_dex_files_index = info->opened_dex_files.size();
+    // We replace the classpath and the checksums with the locations and checksums of the dex
+    // files as we go.
+    //
+    // We do this because initially the classpath contains the paths of the dex files; and
+    // some of them might be multi-dexes. So in order to have a consistent view we replace all the
+    // file paths with the actual dex locations being loaded.
+    // This will allow the context to VerifyClassLoaderContextMatch which expects or multidex
+    // location in the class paths.
+    // Note that this will also remove the paths that could not be opened.
+    std::vector<std::string> dex_locations;
+    std::vector<uint32_t> dex_checksums;
     for (const std::string& cp_elem : info->classpath) {
       // If path is relative, append it to the provided base directory.
       std::string location = cp_elem;
@@ -455,6 +469,22 @@ bool ClassLoaderContext::OpenDexFiles(InstructionSet isa,
       }
 
       std::string error_msg;
+      if (only_read_checksums) {
+        // The location checksums are the zip entry CRC32s (or the header checksum of a plain
+        // dex file), which can be read without extracting or checksumming the dex data.
+        std::vector<uint32_t> checksums;
+        if (dex_file_loader.GetMultiDexChecksums(location.c_str(), &checksums, &error_msg, fd)) {
+          for (size_t i = 0; i < checksums.size(); ++i) {
+            dex_locations.push_back(DexFileLoader::GetMultiDexLocation(i, location.c_str()));
+            dex_checksums.push_back(checksums[i]);
+          }
+          continue;
+        }
+        // Fall through and try to open the dex files, possibly from their oat file.
+        error_msg.clear();
+      }
+
+      size_t opened_dex_files_index = info->opened_dex_files.size();
       // When opening the dex files from the context we expect their checksum to match their
       // contents. So pass true to verify_checksum.
       // We don't need to do structural dex file verification, we only need to
@@ -495,25 +525,16 @@ bool ClassLoaderContext::OpenDexFiles(InstructionSet isa,
         LOG(WARNING) << "Could not open dex files from fd " << fd << " for location: " << location;
         dex_files_open_result_ = false;
       }
+      for (size_t k = opened_dex_files_index; k < info->opened_dex_files.size(); k++) {
+        std::unique_ptr<const DexFile>& dex = info->opened_dex_files[k];
+        dex_locations.push_back(dex->GetLocation());
+        dex_checksums.push_back(dex->GetLocationChecksum());
+      }
     }
 
-    // We finished opening the dex files from the classpath.
-    // Now update the classpath and the checksum with the locations of the dex files.
-    //
-    // We do this because initially the classpath contains the paths of the dex files; and
-    // some of them might be multi-dexes. So in order to have a consistent view we replace all the
-    // file paths with the actual dex locations being loaded.
-    // This will allow the context to VerifyClassLoaderContextMatch which expects or multidex
-    // location in the class paths.
-    // Note that this will also remove the paths that could not be opened.
     info->original_classpath = std::move(info->classpath);
-    info->classpath.clear();
-    info->checksums.clear();
-    for (size_t k = opened_dex_files_index; k < info->opened_dex_files.size(); k++) {
-      std::unique_ptr<const DexFile>& dex = info->opened_dex_files[k];
-      info->classpath.push_back(dex->GetLocation());
-      info->checksums.push_back(dex->GetLocationChecksum());
-    }
+    info->classpath = std::move(dex_locations);
+    info->checksums = std::move(dex_checksums);
     AddToWorkList(info, work_list);
   }
 
@@ -691,19 +712,23 @@ void ClassLoaderContext::EncodeContextInternal(const ClassLoaderInfo& info,
     }
   }
 
-  for (size_t k = 0; k < info.opened_dex_files.size(); k++) {
-    const std::unique_ptr<const DexFile>& dex_file = info.opened_dex_files[k];
+  // If only the checksums were read, there are no opened dex files but the classpath holds
+  // their locations and checksums.
+  const size_t num_dex_files =
+      only_read_checksums_ ? info.classpath.size() : info.opened_dex_files.size();
+  for (size_t k = 0; k < num_dex_files; k++) {
+    std::string location = only_read_checksums_
+        ? info.classpath[k]
+        : info.opened_dex_files[k]->GetLocation();
     if (for_dex2oat) {
       // dex2oat only needs the base location. It cannot accept multidex locations.
       // So ensure we only add each file once.
-      bool new_insert = seen_locations.insert(
-          DexFileLoader::GetBaseLocation(dex_file->GetLocation())).second;
+      bool new_insert = seen_locations.insert(DexFileLoader::GetBaseLocation(location)).second;
       if (!new_insert) {
         continue;
       }
     }
 
-    std::string location = dex_file->GetLocation();
     // If there is a stored class loader remap, fix up the multidex strings.
     if (!remap.empty()) {
       std::string base_dex_location = DexFileLoader::GetBaseLocation(location);
@@ -715,7 +740,9 @@ void ClassLoaderContext::EncodeContextInternal(const ClassLoaderInfo& info,
 
     // dex2oat does not need the checksums.
     if (!for_dex2oat) {
-      checksums.push_back(dex_file->GetLocationChecksum());
+      checksums.push_back(only_read_checksums_
+          ? info.checksums[k]
+          : info.opened_dex_files[k]->GetLocationChecksum());
     }
   }
   EncodeClassPath(base_dir, locations, checksums, info.type, out);
@@ -856,6 +883,7 @@ static ObjPtr<mirror::ClassLoader> CreateClassLoaderInternal(
 jobject ClassLoaderContext::CreateClassLoader(
     const std::vector<const DexFile*>& compilation_sources) const {
   CheckDexFilesOpened("CreateClassLoader");
+  CHECK(!only_read_checksums_) << "CreateClassLoader needs the dex files to be opened";
 
   Thread* self = Thread::Current();
   ScopedObjectAccess soa(self);
@@ -890,6 +918,7 @@ jobject ClassLoaderContext::CreateClassLoader(
 
 std::vector<const DexFile*> ClassLoaderContext::FlattenOpenedDexFiles() const {
   CheckDexFilesOpened("FlattenOpenedDexFiles");
+  CHECK(!only_read_checksums_) << "FlattenOpenedDexFiles needs the dex files to be opened";
 
   std::vector<const DexFile*> result;
   if (class_loader_chain_ == nullptr) {
@@ -78,12 +78,19 @@ class ClassLoaderContext {
   // that we hit a I/O or checksum mismatch error.
   // TODO(calin): Currently there's no easy way to tell the difference.
   //
+  // If `only_read_checksums` is true, the dex files are not opened when their location
+  // checksums can be read directly from the zip or dex file headers. This is enough for
+  // VerifyClassLoaderContextMatch() and EncodeContextForOatFile(), but CreateClassLoader() and
+  // FlattenOpenedDexFiles() must not be called on the context afterwards. In that mode the
+  // dex file contents are not verified, so corrupt class path dex files are not detected.
+  //
   // TODO(calin): we're forced to complicate the flow in this class with a different
   // OpenDexFiles step because the current dex2oat flow requires the dex files be opened before
   // the class loader is created. Consider reworking the dex2oat part.
   bool OpenDexFiles(InstructionSet isa,
                     const std::string& classpath_dir,
-                    const std::vector<int>& context_fds = std::vector<int>());
+                    const std::vector<int>& context_fds = std::vector<int>(),
+                    bool only_read_checksums = false);
 
   // Remove the specified compilation sources from all classpaths present in this context.
   // Should only be called before the first call to OpenDexFiles().
@@ -355,6 +362,8 @@ class ClassLoaderContext {
   bool dex_files_open_attempted_;
   // The result of the last OpenDexFiles() operation.
   bool dex_files_open_result_;
+  // Whether OpenDexFiles() only read the dex file checksums.
+  bool only_read_checksums_;
 
   // Whether or not the context owns the opened dex and oat files.
   // If true, the opened dex files will be de-allocated when the context is destructed.
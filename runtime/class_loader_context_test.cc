@@ -1611,6 +1611,25 @@ TEST_F(ClassLoaderContextTest, VerifyClassLoaderContextMatchAfterEncodingMultide
             ClassLoaderContext::VerificationResult::kVerifies);
 }
 
+TEST_F(ClassLoaderContextTest, VerifyClassLoaderContextMatchOnlyReadChecksums) {
+  std::string multidex_name = GetTestDexFileName("MultiDex");
+  std::string dex_name = GetTestDexFileName("Main");
+  std::string spec = "PCL[" + multidex_name + "];DLC[" + dex_name + "]";
+
+  std::unique_ptr<ClassLoaderContext> opened_context = ClassLoaderContext::Create(spec);
+  ASSERT_TRUE(opened_context->OpenDexFiles(InstructionSet::kArm, /*classpath_dir=*/ ""));
+  std::string encoded_context = opened_context->EncodeContextForOatFile("");
+
+  std::unique_ptr<ClassLoaderContext> context = ClassLoaderContext::Create(spec);
+  ASSERT_TRUE(context->OpenDexFiles(InstructionSet::kArm,
+                                    /*classpath_dir=*/ "",
+                                    /*context_fds=*/ std::vector<int>(),
+                                    /*only_read_checksums=*/ true));
+  ASSERT_EQ(encoded_context, context->EncodeContextForOatFile(""));
+  ASSERT_EQ(context->VerifyClassLoaderContextMatch(encoded_context),
+            ClassLoaderContext::VerificationResult::kVerifies);
+}
+
 TEST_F(ClassLoaderContextTest, CreateContextForClassLoaderWithSharedLibraries) {
   jobject class_loader_a = LoadDexInPathClassLoader("ForClassLoaderA", nullptr);
 
@@ -542,8 +542,16 @@ ALWAYS_INLINE ArtMethod* FindMethodToCall(uint32_t method_idx,
         }
         return imt_method;
       } else {
-        ArtMethod* interface_method = klass->FindVirtualMethodForInterface(
-            resolved_method, class_linker->GetImagePointerSize());
+        // The IMT slot is shared with other interface methods. Its conflict table only holds
+        // the methods mapped to this slot, so search it before the IfTable, which has an
+        // entry for every interface the class implements.
+        ImtConflictTable* conflict_table = imt_method->GetImtConflictTable(pointer_size);
+        ArtMethod* interface_method = (conflict_table != nullptr)
+            ? conflict_table->Lookup(resolved_method, pointer_size)
+            : nullptr;
+        if (interface_method == nullptr) {
+          interface_method = klass->FindVirtualMethodForInterface(resolved_method, pointer_size);
+        }
         if (UNLIKELY(interface_method == nullptr)) {
           ThrowIncompatibleClassChangeErrorClassForInterfaceDispatch(resolved_method,
                                                                      *this_object, referrer);
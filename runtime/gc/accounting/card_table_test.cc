@@ -25,6 +25,7 @@
 #include "mirror/class-inl.h"
 #include "mirror/string-inl.h"  // Strings are easiest to allocate
 #include "scoped_thread_state_change-inl.h"
+#include "space_bitmap-inl.h"
 #include "thread_pool.h"
 
 namespace art {
@@ -145,7 +146,51 @@ TEST_F(CardTableTest, TestModifyCardsAtomic) {
   }
 }
 
-// TODO: Add test for CardTable::Scan.
+TEST_F(CardTableTest, TestScan) {
+  CommonSetup();
+  ContinuousSpaceBitmap bitmap(ContinuousSpaceBitmap::Create(
+      "card table test bitmap", HeapBegin(), HeapLimit() - HeapBegin()));
+  ASSERT_TRUE(bitmap.IsValid());
+  // Mark one object per card and give the cards a mix of clean, aged and dirty values, with
+  // several non-clean cards sharing a word.
+  size_t expected_dirty = 0u;
+  size_t expected_aged_or_dirty = 0u;
+  for (uint8_t* addr = HeapBegin(); addr < HeapLimit(); addr += CardTable::kCardSize) {
+    bitmap.Set(reinterpret_cast<mirror::Object*>(addr));
+    size_t card_index = (addr - HeapBegin()) / CardTable::kCardSize;
+    uint8_t value = (card_index % 3 == 0) ? CardTable::kCardDirty
+        : (card_index % 7 == 0) ? CardTable::kCardAged : CardTable::kCardClean;
+    *card_table_->CardFromAddr(addr) = value;
+    expected_dirty += (value == CardTable::kCardDirty) ? 1u : 0u;
+    expected_aged_or_dirty += (value != CardTable::kCardClean) ? 1u : 0u;
+  }
+  // Start and end off word boundaries to cover the unaligned edges.
+  uint8_t* scan_begin = HeapBegin() + CardTable::kCardSize;
+  uint8_t* scan_end = HeapLimit() - CardTable::kCardSize;
+  if (*card_table_->CardFromAddr(HeapBegin()) == CardTable::kCardDirty) {
+    --expected_dirty;
+    --expected_aged_or_dirty;
+  }
+  uint8_t last_card = *card_table_->CardFromAddr(scan_end);
+  expected_dirty -= (last_card == CardTable::kCardDirty) ? 1u : 0u;
+  expected_aged_or_dirty -= (last_card != CardTable::kCardClean) ? 1u : 0u;
+
+  size_t visited = 0u;
+  auto visitor = [&](mirror::Object* obj) {
+    EXPECT_NE(CardTable::kCardClean, card_table_->GetCard(obj));
+    ++visited;
+  };
+  EXPECT_EQ(expected_dirty,
+            card_table_->Scan</*kClearCard=*/ false>(&bitmap, scan_begin, scan_end, visitor));
+  EXPECT_EQ(expected_dirty, visited);
+
+  visited = 0u;
+  EXPECT_EQ(expected_aged_or_dirty,
+            card_table_->Scan</*kClearCard=*/ false>(
+                &bitmap, scan_begin, scan_end, visitor, CardTable::kCardAged));
+  EXPECT_EQ(expected_aged_or_dirty, visited);
+}
+
 }  // namespace accounting
 }  // namespace gc
 }  // namespace art
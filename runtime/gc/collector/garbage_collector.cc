@@ -177,9 +177,13 @@ void GarbageCollector::Run(GcCause gc_cause, bool clear_soft_references) {
     RegisterPause(current_iteration->GetDurationNs());
   }
   total_time_ns_ += current_iteration->GetDurationNs();
+  metrics::ArtMetrics* metrics = Runtime::Current()->GetMetrics();
+  metrics->GcCollectionCount()->AddOne();
+  metrics->GcTotalTimeMicros()->Add(NsToUs(current_iteration->GetDurationNs()));
   for (uint64_t pause_time : current_iteration->GetPauseTimes()) {
     MutexLock mu(self, pause_histogram_lock_);
     pause_histogram_.AdjustAndAddValue(pause_time);
+    metrics->GcPauseTimeMicros()->Add(NsToUs(pause_time));
   }
   is_transaction_active_ = false;
 }
@@ -148,6 +148,21 @@ void InitializeCorePlatformApiPrivateFields() {
   }
 }
 
+bool DexFlagsCache::Lookup(const void* member, /*out*/ uint32_t* dex_flags) {
+  MutexLock mu(Thread::Current(), lock_);
+  auto it = dex_flags_.find(member);
+  if (it == dex_flags_.end()) {
+    return false;
+  }
+  *dex_flags = it->second;
+  return true;
+}
+
+void DexFlagsCache::Insert(const void* member, uint32_t dex_flags) {
+  MutexLock mu(Thread::Current(), lock_);
+  dex_flags_.Overwrite(member, dex_flags);
+}
+
 namespace detail {
 
 // Do not change the values of items in this enum, as they are written to the
@@ -364,6 +379,14 @@ static ALWAYS_INLINE uint32_t GetMemberDexIndex(ArtMethod* method)
   return method->GetNonObsoleteMethod()->GetDexMethodIndex();
 }
 
+static ALWAYS_INLINE bool IsMemberCopied(ArtField* field ATTRIBUTE_UNUSED) {
+  return false;
+}
+
+static ALWAYS_INLINE bool IsMemberCopied(ArtMethod* method) {
+  return method->IsCopied();
+}
+
 static void VisitMembers(const DexFile& dex_file,
                          const dex::ClassDef& class_def,
                          const std::function<void(const ClassAccessor::Field&)>& fn_visit) {
@@ -388,6 +411,17 @@ uint32_t GetDexFlags(T* member) REQUIRES_SHARED(Locks::mutator_lock_) {
   ObjPtr<mirror::Class> declaring_class = member->GetDeclaringClass();
   DCHECK(!declaring_class.IsNull()) << "Attempting to access a runtime method";
 
+  // Only members of boot class path classes are cached. Other classes can be unloaded
+  // and the memory of their members reused. This includes copied methods, which live in
+  // the methods array of the (possibly non-boot) class they were copied into.
+  DexFlagsCache* cache = (declaring_class->IsBootStrapClassLoaded() && !IsMemberCopied(member))
+      ? Runtime::Current()->GetHiddenApiDexFlagsCache()
+      : nullptr;
+  uint32_t cached_flags;
+  if (cache != nullptr && cache->Lookup(member, &cached_flags)) {
+    return cached_flags;
+  }
+
   ApiList flags;
   DCHECK(!flags.IsValid());
 
@@ -439,6 +473,9 @@ uint32_t GetDexFlags(T* member) REQUIRES_SHARED(Locks::mutator_lock_) {
 
   CHECK(flags.IsValid()) << "Could not find hiddenapi flags for "
       << Dumpable<MemberSignature>(MemberSignature(member));
+  if (cache != nullptr) {
+    cache->Insert(member, flags.GetDexFlags());
+  }
   return flags.GetDexFlags();
 }
 
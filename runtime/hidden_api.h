@@ -22,6 +22,8 @@
 #include "base/hiddenapi_domain.h"
 #include "base/hiddenapi_flags.h"
 #include "base/locks.h"
+#include "base/mutex.h"
+#include "base/safe_map.h"
 #include "intrinsics_enum.h"
 #include "jni/jni_internal.h"
 #include "mirror/class-inl.h"
@@ -160,6 +162,27 @@ class ScopedHiddenApiEnforcementPolicySetting {
 
 void InitializeCorePlatformApiPrivateFields() REQUIRES(!Locks::mutator_lock_);
 
+// Cache of hiddenapi dex flags decoded for boot class path members. Finding the flags
+// of a member walks the class data of its declaring class, and members to which access
+// was denied are never marked as public API in their runtime access flags, so without
+// the cache the walk would be repeated on every denied access. The flags of a member
+// never change and boot class path members are never unloaded, so entries do not need
+// to be invalidated. Methods copied into other classes are not boot class path members
+// in that sense and are never cached.
+class DexFlagsCache {
+ public:
+  DexFlagsCache() : lock_("hiddenapi dex flags cache lock", kGenericBottomLock) {}
+
+  bool Lookup(const void* member, /*out*/ uint32_t* dex_flags) REQUIRES(!lock_);
+  void Insert(const void* member, uint32_t dex_flags) REQUIRES(!lock_);
+
+ private:
+  Mutex lock_;
+  SafeMap<const void*, uint32_t> dex_flags_ GUARDED_BY(lock_);
+
+  DISALLOW_COPY_AND_ASSIGN(DexFlagsCache);
+};
+
 // Implementation details. DO NOT ACCESS DIRECTLY.
 namespace detail {
 
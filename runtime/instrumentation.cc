@@ -1010,6 +1010,29 @@ bool Instrumentation::IsDeoptimizedMethodsEmpty() const {
   return deoptimized_methods_.empty();
 }
 
+// Returns true if any thread has a frame (including inlined frames) of the given method.
+static bool HasActiveFrames(ArtMethod* method)
+    REQUIRES(Locks::mutator_lock_, Locks::thread_list_lock_) {
+  for (Thread* thread : Runtime::Current()->GetThreadList()->GetList()) {
+    bool found = false;
+    StackVisitor::WalkStack(
+        [&](const art::StackVisitor* stack_visitor) REQUIRES_SHARED(Locks::mutator_lock_) {
+          if (stack_visitor->GetMethod() == method) {
+            found = true;
+            return false;
+          }
+          return true;
+        },
+        thread,
+        /* context= */ nullptr,
+        art::StackVisitor::StackWalkKind::kIncludeInlinedFrames);
+    if (found) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void Instrumentation::Deoptimize(ArtMethod* method) {
   CHECK(!method->IsNative());
   CHECK(!method->IsProxyMethod());
@@ -1022,14 +1045,28 @@ void Instrumentation::Deoptimize(ArtMethod* method) {
     CHECK(has_not_been_deoptimized) << "Method " << ArtMethod::PrettyMethod(method)
         << " is already deoptimized";
   }
+  // Only the compiled code that inlined the method needs to be thrown away, the rest of the
+  // compiled code keeps calling the method through its (now deoptimized) entrypoint.
+  jit::Jit* jit = Runtime::Current()->GetJit();
+  if (jit != nullptr) {
+    jit->GetCodeCache()->InvalidateCompiledCodeInlining(method);
+  }
   if (!interpreter_stubs_installed_) {
     UpdateEntrypoints(method, GetQuickInstrumentationEntryPoint());
 
     // Install instrumentation exit stub and instrumentation frames. We may already have installed
-    // these previously so it will only cover the newly created frames.
+    // these previously so it will only cover the newly created frames. Exit stubs are only needed
+    // to deoptimize frames of the method that are already live, so if there are none we can skip
+    // walking and patching every thread's stack. All future invocations go through the
+    // instrumentation entrypoint updated above.
     instrumentation_stubs_installed_ = true;
     MutexLock mu(self, *Locks::thread_list_lock_);
-    Runtime::Current()->GetThreadList()->ForEach(InstrumentationInstallStack, this);
+    if (HasActiveFrames(method)) {
+      Runtime::Current()->GetThreadList()->ForEach(InstrumentationInstallStack, this);
+    } else {
+      VLOG(deopt) << "Skipping stack instrumentation for " << method->PrettyMethod()
+                  << " since it has no active frames";
+    }
   }
 }
 
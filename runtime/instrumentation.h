@@ -253,11 +253,14 @@ class Instrumentation {
                !Locks::classlinker_classes_lock_,
                !GetDeoptimizedMethodsLock());
 
-  // Deoptimize a method by forcing its execution with the interpreter. Nevertheless, a static
-  // method (except a class initializer) set to the resolution trampoline will be deoptimized only
-  // once its declaring class is initialized.
+  // Deoptimize a method by forcing its execution with the interpreter. JIT code that inlined the
+  // method is invalidated. Nevertheless, a static method (except a class initializer) set to the
+  // resolution trampoline will be deoptimized only once its declaring class is initialized.
   void Deoptimize(ArtMethod* method)
-      REQUIRES(Locks::mutator_lock_, !Locks::thread_list_lock_, !GetDeoptimizedMethodsLock());
+      REQUIRES(Locks::mutator_lock_,
+               !Locks::thread_list_lock_,
+               !Locks::jit_lock_,
+               !GetDeoptimizedMethodsLock());
 
   // Undeoptimze the method by restoring its entrypoints. Nevertheless, a static method
   // (except a class initializer) set to the resolution trampoline will be updated only once its
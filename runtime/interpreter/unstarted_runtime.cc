@@ -1172,6 +1172,17 @@ void UnstartedRuntime::UnstartedMathPow(
                    shadow_frame->GetVRegDouble(arg_offset + 2)));
 }
 
+void UnstartedRuntime::UnstartedMathRint(
+    Thread* self ATTRIBUTE_UNUSED, ShadowFrame* shadow_frame, JValue* result, size_t arg_offset) {
+  // Java's rint() rounds half to even, as does the default IEEE rounding mode.
+  result->SetD(rint(shadow_frame->GetVRegDouble(arg_offset)));
+}
+
+void UnstartedRuntime::UnstartedMathSqrt(
+    Thread* self ATTRIBUTE_UNUSED, ShadowFrame* shadow_frame, JValue* result, size_t arg_offset) {
+  result->SetD(sqrt(shadow_frame->GetVRegDouble(arg_offset)));
+}
+
 void UnstartedRuntime::UnstartedObjectHashCode(
     Thread* self ATTRIBUTE_UNUSED, ShadowFrame* shadow_frame, JValue* result, size_t arg_offset) {
   mirror::Object* obj = shadow_frame->GetVRegReference(arg_offset);
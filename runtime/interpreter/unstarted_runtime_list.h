@@ -50,6 +50,8 @@
   V(MathSin, "double java.lang.Math.sin(double)") \
   V(MathCos, "double java.lang.Math.cos(double)") \
   V(MathPow, "double java.lang.Math.pow(double, double)") \
+  V(MathRint, "double java.lang.Math.rint(double)") \
+  V(MathSqrt, "double java.lang.Math.sqrt(double)") \
   V(ObjectHashCode, "int java.lang.Object.hashCode()") \
   V(DoubleDoubleToRawLongBits, "long java.lang.Double.doubleToRawLongBits(double)") \
   V(MemoryPeekByte, "byte libcore.io.Memory.peekByte(long)") \
@@ -877,6 +877,53 @@ TEST_F(UnstartedRuntimeTest, Pow) {
   EXPECT_EQ(UINT64_C(0x3f8c5c51326aa7ee), lresult);
 }
 
+TEST_F(UnstartedRuntimeTest, Rint) {
+  Thread* self = Thread::Current();
+  ScopedObjectAccess soa(self);
+
+  UniqueDeoptShadowFramePtr tmp = CreateShadowFrame(10, nullptr, nullptr, 0);
+
+  constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  constexpr double test_pairs[][2] = {
+      { -0.0, -0.0 },
+      {  0.0,  0.0 },
+      { -0.5, -0.0 },
+      {  0.5,  0.0 },
+      {  1.5,  2.0 },
+      {  2.5,  2.0 },
+      { -2.5, -2.0 },
+      {  nan,  nan },
+      {  inf,  inf },
+      { -inf, -inf }
+  };
+
+  for (size_t i = 0; i < arraysize(test_pairs); ++i) {
+    tmp->SetVRegDouble(0, test_pairs[i][0]);
+    JValue result;
+    UnstartedMathRint(self, tmp.get(), &result, 0);
+    const uint64_t lresult = static_cast<uint64_t>(result.GetJ());
+    const uint64_t expected = bit_cast<uint64_t, double>(test_pairs[i][1]);
+    EXPECT_EQ(expected, lresult) << test_pairs[i][0];
+  }
+}
+
+TEST_F(UnstartedRuntimeTest, Sqrt) {
+  Thread* self = Thread::Current();
+  ScopedObjectAccess soa(self);
+
+  UniqueDeoptShadowFramePtr tmp = CreateShadowFrame(10, nullptr, nullptr, 0);
+
+  // sqrt(2.0) is correctly rounded, so the result is the same on every host.
+  tmp->SetVRegDouble(0, 2.0);
+
+  JValue result;
+  UnstartedMathSqrt(self, tmp.get(), &result, 0);
+
+  const uint64_t lresult = static_cast<uint64_t>(result.GetJ());
+  EXPECT_EQ(UINT64_C(0x3ff6a09e667f3bcd), lresult);
+}
+
 TEST_F(UnstartedRuntimeTest, IsAnonymousClass) {
   Thread* self = Thread::Current();
   ScopedObjectAccess soa(self);
@@ -19,6 +19,7 @@
 #include <dlfcn.h>
 
 #include "art_method-inl.h"
+#include "base/arena_allocator.h"
 #include "base/enums.h"
 #include "base/file_utils.h"
 #include "base/logging.h"  // For VLOG.
@@ -198,6 +199,10 @@ JitOptions* JitOptions::CreateFromRuntimeArguments(const RuntimeArgumentMap& opt
 void Jit::DumpInfo(std::ostream& os) {
   code_cache_->Dump(os);
   cumulative_timings_.Dump(os);
+  ArenaPool* jit_arena_pool = Runtime::Current()->GetJitArenaPool();
+  if (jit_arena_pool != nullptr) {
+    jit_arena_pool->DumpStats(os);
+  }
   MutexLock mu(Thread::Current(), lock_);
   memory_use_.PrintMemoryUse(os);
 }
@@ -337,7 +342,14 @@ bool Jit::CompileMethod(ArtMethod* method, Thread* self, bool baseline, bool osr
             << ArtMethod::PrettyMethod(method_to_compile)
             << " osr=" << std::boolalpha << osr
             << " baseline=" << std::boolalpha << baseline;
-  bool success = jit_compiler_->CompileMethod(self, region, method_to_compile, baseline, osr);
+  metrics::ArtMetrics* metrics = Runtime::Current()->GetMetrics();
+  bool success;
+  {
+    metrics::ScopedMetricsTiming timing(metrics->JitMethodCompileTotalTimeMicros(),
+                                        metrics->JitMethodCompileTimeMicros());
+    success = jit_compiler_->CompileMethod(self, region, method_to_compile, baseline, osr);
+  }
+  metrics->JitMethodCompileCount()->AddOne();
   code_cache_->DoneCompiling(method_to_compile, self, osr);
   if (!success) {
     VLOG(jit) << "Failed to compile method "
@@ -1431,8 +1443,9 @@ uint32_t Jit::CompileMethodsFromProfile(
     return 0u;
   }
   ScopedObjectAccess soa(self);
-  StackHandleScope<1> hs(self);
+  StackHandleScope<2> hs(self);
   MutableHandle<mirror::DexCache> dex_cache = hs.NewHandle<mirror::DexCache>(nullptr);
+  MutableHandle<mirror::Class> klass = hs.NewHandle<mirror::Class>(nullptr);
   ClassLinker* class_linker = Runtime::Current()->GetClassLinker();
   uint32_t added_to_queue = 0u;
   for (const DexFile* dex_file : dex_files) {
@@ -1455,6 +1468,45 @@ uint32_t Jit::CompileMethodsFromProfile(
     dex_cache.Assign(class_linker->FindDexCache(self, *dex_file));
     CHECK(dex_cache != nullptr) << "Could not find dex cache for " << dex_file->GetLocation();
 
+    // Load and verify the classes of the profile ahead of their first use, so that the
+    // threads running startup code find them linked. Initialization is left to the first
+    // thread using each class: running static initializers here would change their order
+    // and could deadlock with threads initializing dependent classes.
+    // Only classes that the oat file records as verified are preloaded. They were loaded,
+    // linked and verified against the same class path when compiling, so preloading them
+    // cannot raise and cache a linkage or verification error that application code would
+    // otherwise see first, and their verification just takes the oat file status.
+    // This is not done in the zygote, where it would delay the ZygoteTask and with it the
+    // compilation of the boot profile methods.
+    const OatDexFile* oat_dex_file = dex_file->GetOatDexFile();
+    if (self->CanLoadClasses() &&
+        !Runtime::Current()->IsZygote() &&
+        oat_dex_file != nullptr &&
+        oat_dex_file->GetOatFile() != nullptr) {
+      for (dex::TypeIndex type_idx : class_types) {
+        const dex::ClassDef* class_def = dex_file->FindClassDef(type_idx);
+        if (class_def == nullptr) {
+          continue;
+        }
+        ClassStatus oat_class_status =
+            oat_dex_file->GetOatClass(dex_file->GetIndexForClassDef(*class_def)).GetStatus();
+        if (oat_class_status < ClassStatus::kVerifiedNeedsAccessChecks) {
+          continue;
+        }
+        klass.Assign(class_linker->ResolveType(type_idx, dex_cache, class_loader));
+        if (klass == nullptr) {
+          self->ClearException();
+          continue;
+        }
+        // The descriptor may resolve to a class defined by an earlier dex file of the class
+        // path, to which the oat status above does not apply.
+        if (!klass->IsVerified() && klass->GetDexCache() == dex_cache.Get()) {
+          class_linker->VerifyClass(self, klass);
+          self->ClearException();
+        }
+      }
+    }
+
     for (uint16_t method_idx : all_methods) {
       if (CompileMethodFromProfile(self,
                                    class_linker,
@@ -16,6 +16,7 @@
 
 #include "jit_code_cache.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include <android-base/logging.h>
@@ -490,6 +491,8 @@ void JitCodeCache::FreeAllMethodHeaders(
         ->RemoveDependentsWithMethodHeaders(method_headers);
   }
 
+  RemoveInliningDependentsWithMethodHeaders(method_headers);
+
   // Remove compressed mini-debug info for the methods.
   std::vector<const void*> removed_symbols;
   removed_symbols.reserve(method_headers.size());
@@ -505,6 +508,29 @@ void JitCodeCache::FreeAllMethodHeaders(
   }
 }
 
+void JitCodeCache::RemoveInliningDependentsWithMethodHeaders(
+    const std::unordered_set<OatQuickMethodHeader*>& method_headers) {
+  if (method_headers.empty()) {
+    return;
+  }
+  for (auto it = inlining_dependents_.begin(); it != inlining_dependents_.end();) {
+    std::vector<const void*>& dependents = it->second;
+    dependents.erase(
+        std::remove_if(dependents.begin(),
+                       dependents.end(),
+                       [&](const void* code_ptr) {
+                         return method_headers.find(OatQuickMethodHeader::FromCodePointer(
+                             code_ptr)) != method_headers.end();
+                       }),
+        dependents.end());
+    if (dependents.empty()) {
+      it = inlining_dependents_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
 void JitCodeCache::RemoveMethodsIn(Thread* self, const LinearAlloc& alloc) {
   ScopedTrace trace(__PRETTY_FUNCTION__);
   // We use a set to first collect all method_headers whose code need to be
@@ -546,6 +572,14 @@ void JitCodeCache::RemoveMethodsIn(Thread* self, const LinearAlloc& alloc) {
         ++it;
       }
     }
+    for (auto it = inlining_dependents_.begin(); it != inlining_dependents_.end();) {
+      if (alloc.ContainsUnsafe(it->first)) {
+        // Code inlining the method is going to be removed in FreeCode() below.
+        it = inlining_dependents_.erase(it);
+      } else {
+        ++it;
+      }
+    }
     for (auto it = profiling_infos_.begin(); it != profiling_infos_.end();) {
       ProfilingInfo* info = *it;
       if (alloc.ContainsUnsafe(info->GetMethod())) {
@@ -644,7 +678,8 @@ bool JitCodeCache::Commit(Thread* self,
                           ArrayRef<const uint8_t> stack_map,
                           bool osr,
                           bool has_should_deoptimize_flag,
-                          const ArenaSet<ArtMethod*>& cha_single_implementation_list) {
+                          const ArenaSet<ArtMethod*>& cha_single_implementation_list,
+                          const ArenaSet<ArtMethod*>& inlined_methods) {
   DCHECK(!method->IsNative() || !osr);
 
   if (!method->IsNative()) {
@@ -698,6 +733,19 @@ bool JitCodeCache::Commit(Thread* self,
       VLOG(jit) << "JIT discarded jitted code due to invalid single-implementation assumptions.";
       return false;
     }
+
+    // The inliner only rejects deoptimized methods at compile time. Re-check under the lock so
+    // that a method deoptimized or redefined since cannot be missed by
+    // InvalidateCompiledCodeInlining() before its dependents are recorded below.
+    instrumentation::Instrumentation* instrumentation = Runtime::Current()->GetInstrumentation();
+    for (ArtMethod* inlined_method : inlined_methods) {
+      if (inlined_method->IsObsolete() || instrumentation->IsDeoptimized(inlined_method)) {
+        ClearMethodCounter(method, /*was_warm=*/ false);
+        VLOG(jit) << "JIT discarded jitted code inlining deoptimized or obsolete method "
+                  << inlined_method->PrettyMethod();
+        return false;
+      }
+    }
     DCHECK(cha_single_implementation_list.empty() || !Runtime::Current()->IsJavaDebuggable())
         << "Should not be using cha on debuggable apps/runs!";
 
@@ -721,6 +769,10 @@ bool JitCodeCache::Commit(Thread* self,
       } else {
         method_code_map_.Put(code_ptr, method);
       }
+      for (ArtMethod* inlined_method : inlined_methods) {
+        inlining_dependents_.GetOrCreate(
+            inlined_method, []() { return std::vector<const void*>(); }).push_back(code_ptr);
+      }
       if (osr) {
         number_of_osr_compilations_++;
         osr_code_map_.Put(method, code_ptr);
@@ -811,9 +863,11 @@ bool JitCodeCache::RemoveMethodLocked(ArtMethod* method, bool release_memory) {
       }
     }
   } else {
+    std::unordered_set<OatQuickMethodHeader*> removed_headers;
     for (auto it = method_code_map_.begin(); it != method_code_map_.end();) {
       if (it->second == method) {
         in_cache = true;
+        removed_headers.insert(OatQuickMethodHeader::FromCodePointer(it->first));
         if (release_memory) {
           FreeCodeAndData(it->first);
         }
@@ -822,6 +876,7 @@ bool JitCodeCache::RemoveMethodLocked(ArtMethod* method, bool release_memory) {
         ++it;
       }
     }
+    RemoveInliningDependentsWithMethodHeaders(removed_headers);
 
     auto osr_it = osr_code_map_.find(method);
     if (osr_it != osr_code_map_.end()) {
@@ -836,6 +891,8 @@ bool JitCodeCache::RemoveMethodLocked(ArtMethod* method, bool release_memory) {
 // any cached information it has on the method. All threads must be suspended before calling this
 // method. The compiled code for the method (if there is any) must not be in any threads call stack.
 void JitCodeCache::NotifyMethodRedefined(ArtMethod* method) {
+  // Code that inlined the previous definition must not be entered anymore either.
+  InvalidateCompiledCodeInlining(method);
   MutexLock mu(Thread::Current(), *Locks::jit_lock_);
   RemoveMethodLocked(method, /* release_memory= */ true);
 }
@@ -1760,6 +1817,38 @@ void JitCodeCache::InvalidateAllCompiledCode() {
             << osr_size << " OSRs.";
 }
 
+void JitCodeCache::InvalidateCompiledCodeInlining(ArtMethod* method) {
+  std::vector<std::pair<ArtMethod*, const OatQuickMethodHeader*>> to_invalidate;
+  {
+    MutexLock mu(Thread::Current(), *Locks::jit_lock_);
+    auto it = inlining_dependents_.find(method);
+    if (it == inlining_dependents_.end()) {
+      return;
+    }
+    for (const void* code_ptr : it->second) {
+      const OatQuickMethodHeader* header = OatQuickMethodHeader::FromCodePointer(code_ptr);
+      auto code_it = method_code_map_.find(code_ptr);
+      if (code_it != method_code_map_.end()) {
+        to_invalidate.emplace_back(code_it->second, header);
+        continue;
+      }
+      // Code compiled by the zygote is only in the zygote map, which is keyed by method.
+      for (const ZygoteMap::Entry& entry : zygote_map_) {
+        if (entry.code_ptr == code_ptr) {
+          to_invalidate.emplace_back(entry.method, header);
+          break;
+        }
+      }
+    }
+    inlining_dependents_.erase(it);
+  }
+  for (const auto& [caller, header] : to_invalidate) {
+    VLOG(jit) << "Invalidating compiled code of " << caller->PrettyMethod()
+              << " which inlined " << method->PrettyMethod();
+    InvalidateCompiledCodeFor(caller, header);
+  }
+}
+
 void JitCodeCache::InvalidateCompiledCodeFor(ArtMethod* method,
                                              const OatQuickMethodHeader* header) {
   DCHECK(!method->IsNative());
@@ -258,6 +258,9 @@ class JitCodeCache {
   // single-implementation assumptions are violated later. This needs to be done
   // even if `has_should_deoptimize_flag` is false, which can happen due to CHA
   // guard elimination.
+  //
+  // `inlined_methods` are recorded so that the compiled code can be invalidated
+  // when one of the methods it inlined gets deoptimized or redefined.
   bool Commit(Thread* self,
               JitMemoryRegion* region,
               ArtMethod* method,
@@ -268,7 +271,8 @@ class JitCodeCache {
               ArrayRef<const uint8_t> stack_map,      // Compiler output (source).
               bool osr,
               bool has_should_deoptimize_flag,
-              const ArenaSet<ArtMethod*>& cha_single_implementation_list)
+              const ArenaSet<ArtMethod*>& cha_single_implementation_list,
+              const ArenaSet<ArtMethod*>& inlined_methods)
       REQUIRES_SHARED(Locks::mutator_lock_)
       REQUIRES(!Locks::jit_lock_);
 
@@ -338,6 +342,13 @@ class JitCodeCache {
       REQUIRES(!Locks::jit_lock_)
       REQUIRES_SHARED(Locks::mutator_lock_);
 
+  // Invalidate the compiled code of all methods that inlined `method`, so that new
+  // invocations no longer execute the inlined body. Frames already running that code
+  // are not affected.
+  void InvalidateCompiledCodeInlining(ArtMethod* method)
+      REQUIRES(!Locks::jit_lock_)
+      REQUIRES_SHARED(Locks::mutator_lock_);
+
   void Dump(std::ostream& os) REQUIRES(!Locks::jit_lock_);
 
   bool IsOsrCompiled(ArtMethod* method) REQUIRES(!Locks::jit_lock_);
@@ -430,6 +441,11 @@ class JitCodeCache {
       REQUIRES(!Locks::jit_lock_)
       REQUIRES(!Locks::cha_lock_);
 
+  // Remove inlining dependencies on the code of entries in `method_headers`.
+  void RemoveInliningDependentsWithMethodHeaders(
+      const std::unordered_set<OatQuickMethodHeader*>& method_headers)
+      REQUIRES(Locks::jit_lock_);
+
   // Removes method from the cache. The caller must ensure that all threads
   // are suspended and the method should not be in any thread's stack.
   bool RemoveMethodLocked(ArtMethod* method, bool release_memory)
@@ -519,6 +535,9 @@ class JitCodeCache {
   // Holds osr compiled code associated to the ArtMethod.
   SafeMap<ArtMethod*, const void*> osr_code_map_ GUARDED_BY(Locks::jit_lock_);
 
+  // Holds, for each inlined method, the compiled code of the methods that inlined it.
+  SafeMap<ArtMethod*, std::vector<const void*>> inlining_dependents_ GUARDED_BY(Locks::jit_lock_);
+
   // ProfilingInfo objects we have allocated.
   std::vector<ProfilingInfo*> profiling_infos_ GUARDED_BY(Locks::jit_lock_);
 
@@ -918,7 +918,15 @@ bool OatFileAssistant::OatFileInfo::ClassLoaderContextIsOkay(ClassLoaderContext*
       ? oat_file_assistant_->dex_location_.substr(0, dir_index)
       : "";
 
-  if (!context->OpenDexFiles(oat_file_assistant_->isa_, classpath_dir, context_fds)) {
+  // Matching the context only needs the dex locations and checksums, so avoid opening and
+  // checksumming the contents of every class path element. Note that this means a class path
+  // element whose dex contents are corrupt but whose zip or dex header checksum still matches
+  // no longer fails this check. Such an element fails when the class loader opens it, which
+  // is also where a corrupt element that was never compiled against would be reported.
+  if (!context->OpenDexFiles(oat_file_assistant_->isa_,
+                             classpath_dir,
+                             context_fds,
+                             /*only_read_checksums=*/ true)) {
     VLOG(oat) << "ClassLoaderContext check failed: dex files from the context could not be opened";
     return false;
   }
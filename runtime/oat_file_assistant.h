@@ -127,6 +127,15 @@ class OatFileAssistant {
   // path.
   bool IsInBootClassPath();
 
+  // Seeds the boot class path checksums cache with the ones already validated by `other`,
+  // so that oat files compiled against the same boot class path do not need to verify
+  // them again. Both assistants must be for the same instruction set.
+  void CopyValidatedBootClassPathChecksums(const OatFileAssistant& other) {
+    DCHECK_EQ(isa_, other.isa_);
+    cached_boot_class_path_ = other.cached_boot_class_path_;
+    cached_boot_class_path_checksums_ = other.cached_boot_class_path_checksums_;
+  }
+
   // Return what action needs to be taken to produce up-to-date code for this
   // dex location. If "downgrade" is set to false, it verifies if the current
   // compiler filter is at least as good as an oat file generated with the
@@ -289,6 +289,9 @@ std::unique_ptr<RuntimeParser> ParsedOptions::MakeParser(bool ignore_unrecognize
       .Define("-Xmethod-trace-file-size:_")
           .WithType<unsigned int>()
           .IntoKey(M::MethodTraceFileSize)
+      .Define("-Xmetrics-snapshot-file:_")
+          .WithType<std::string>()
+          .IntoKey(M::MetricsSnapshotFile)
       .Define("-Xmethod-trace-stream")
           .IntoKey(M::MethodTraceStreaming)
       .Define("-Xprofile:_")
@@ -780,6 +783,7 @@ void ParsedOptions::Usage(const char* fmt, ...) {
   UsageMessage(stream, "  -Xmethod-trace\n");
   UsageMessage(stream, "  -Xmethod-trace-file:filename\n");
   UsageMessage(stream, "  -Xmethod-trace-file-size:integervalue\n");
+  UsageMessage(stream, "  -Xmetrics-snapshot-file:filename\n");
   UsageMessage(stream, "  -Xps-min-save-period-ms:integervalue\n");
   UsageMessage(stream, "  -Xps-save-resolved-classes-delay-ms:integervalue\n");
   UsageMessage(stream, "  -Xps-hot-startup-method-samples:integervalue\n");
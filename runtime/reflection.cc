@@ -214,12 +214,28 @@ class ArgArray {
     }
   }
 
-  static void ThrowIllegalPrimitiveArgumentException(const char* expected,
-                                                     const char* found_descriptor)
+  // Reads the value of `arg` if it is a primitive box. The box classes are final, so an
+  // exact class comparison is enough and avoids matching on class descriptors.
+  static bool UnboxArgument(ObjPtr<mirror::Object> arg, Primitive::Type* type, JValue* value)
       REQUIRES_SHARED(Locks::mutator_lock_) {
-    ThrowIllegalArgumentException(
-        StringPrintf("Invalid primitive conversion from %s to %s", expected,
-                     PrettyDescriptor(found_descriptor).c_str()).c_str());
+    ObjPtr<mirror::Class> klass = arg->GetClass();
+#define UNBOX_ARGUMENT(box_name, primitive_type, get_fn, set_fn)                     \
+    if (klass == jni::DecodeArtMethod(WellKnownClasses::java_lang_##box_name##_valueOf) \
+                     ->GetDeclaringClass()) {                                          \
+      *type = primitive_type;                                                          \
+      value->set_fn(klass->GetInstanceField(0)->get_fn(arg));                          \
+      return true;                                                                     \
+    }
+    UNBOX_ARGUMENT(Integer, Primitive::kPrimInt, GetInt, SetI)
+    UNBOX_ARGUMENT(Long, Primitive::kPrimLong, GetLong, SetJ)
+    UNBOX_ARGUMENT(Boolean, Primitive::kPrimBoolean, GetBoolean, SetZ)
+    UNBOX_ARGUMENT(Double, Primitive::kPrimDouble, GetDouble, SetD)
+    UNBOX_ARGUMENT(Float, Primitive::kPrimFloat, GetFloat, SetF)
+    UNBOX_ARGUMENT(Character, Primitive::kPrimChar, GetChar, SetC)
+    UNBOX_ARGUMENT(Short, Primitive::kPrimShort, GetShort, SetS)
+    UNBOX_ARGUMENT(Byte, Primitive::kPrimByte, GetByte, SetB)
+#undef UNBOX_ARGUMENT
+    return false;
   }
 
   bool BuildArgArrayFromObjectArray(ObjPtr<mirror::Object> receiver,
@@ -259,99 +275,38 @@ class ArgArray {
         }
       }
 
-#define DO_FIRST_ARG(match_descriptor, get_fn, append) { \
-          if (LIKELY(arg != nullptr && \
-              arg->GetClass()->DescriptorEquals(match_descriptor))) { \
-            ArtField* primitive_field = arg->GetClass()->GetInstanceField(0); \
-            append(primitive_field-> get_fn(arg.Get()));
-
-#define DO_ARG(match_descriptor, get_fn, append) \
-          } else if (LIKELY(arg != nullptr && \
-                            arg->GetClass<>()->DescriptorEquals(match_descriptor))) { \
-            ArtField* primitive_field = arg->GetClass()->GetInstanceField(0); \
-            append(primitive_field-> get_fn(arg.Get()));
-
-#define DO_FAIL(expected) \
-          } else { \
-            if (arg->GetClass<>()->IsPrimitive()) { \
-              std::string temp; \
-              ThrowIllegalPrimitiveArgumentException(expected, \
-                                                     arg->GetClass<>()->GetDescriptor(&temp)); \
-            } else { \
-              ThrowIllegalArgumentException(\
-                  StringPrintf("method %s argument %zd has type %s, got %s", \
-                      ArtMethod::PrettyMethod(m, false).c_str(), \
-                      args_offset + 1, \
-                      expected, \
-                      mirror::Object::PrettyTypeOf(arg.Get()).c_str()).c_str()); \
-            } \
-            return false; \
-          } }
-
-      switch (shorty_[i]) {
-        case 'L':
-          Append(arg.Get());
-          break;
-        case 'Z':
-          DO_FIRST_ARG("Ljava/lang/Boolean;", GetBoolean, Append)
-          DO_FAIL("boolean")
-          break;
-        case 'B':
-          DO_FIRST_ARG("Ljava/lang/Byte;", GetByte, Append)
-          DO_FAIL("byte")
-          break;
-        case 'C':
-          DO_FIRST_ARG("Ljava/lang/Character;", GetChar, Append)
-          DO_FAIL("char")
-          break;
-        case 'S':
-          DO_FIRST_ARG("Ljava/lang/Short;", GetShort, Append)
-          DO_ARG("Ljava/lang/Byte;", GetByte, Append)
-          DO_FAIL("short")
-          break;
-        case 'I':
-          DO_FIRST_ARG("Ljava/lang/Integer;", GetInt, Append)
-          DO_ARG("Ljava/lang/Character;", GetChar, Append)
-          DO_ARG("Ljava/lang/Short;", GetShort, Append)
-          DO_ARG("Ljava/lang/Byte;", GetByte, Append)
-          DO_FAIL("int")
+      if (shorty_[i] == 'L') {
+        Append(arg.Get());
+        continue;
+      }
+      // Null primitive arguments have been rejected above.
+      Primitive::Type dst_type = Primitive::GetType(shorty_[i]);
+      Primitive::Type src_type;
+      JValue value;
+      if (UNLIKELY(!UnboxArgument(arg.Get(), &src_type, &value) ||
+                   !ConvertPrimitiveValueNoThrow(src_type, dst_type, value, &value))) {
+        ThrowIllegalArgumentException(
+            StringPrintf("method %s argument %zd has type %s, got %s",
+                ArtMethod::PrettyMethod(m, false).c_str(),
+                args_offset + 1,
+                PrettyDescriptor(dst_type).c_str(),
+                mirror::Object::PrettyTypeOf(arg.Get()).c_str()).c_str());
+        return false;
+      }
+      switch (dst_type) {
+        case Primitive::kPrimLong:
+          AppendWide(value.GetJ());
           break;
-        case 'J':
-          DO_FIRST_ARG("Ljava/lang/Long;", GetLong, AppendWide)
-          DO_ARG("Ljava/lang/Integer;", GetInt, AppendWide)
-          DO_ARG("Ljava/lang/Character;", GetChar, AppendWide)
-          DO_ARG("Ljava/lang/Short;", GetShort, AppendWide)
-          DO_ARG("Ljava/lang/Byte;", GetByte, AppendWide)
-          DO_FAIL("long")
+        case Primitive::kPrimFloat:
+          AppendFloat(value.GetF());
           break;
-        case 'F':
-          DO_FIRST_ARG("Ljava/lang/Float;", GetFloat, AppendFloat)
-          DO_ARG("Ljava/lang/Long;", GetLong, AppendFloat)
-          DO_ARG("Ljava/lang/Integer;", GetInt, AppendFloat)
-          DO_ARG("Ljava/lang/Character;", GetChar, AppendFloat)
-          DO_ARG("Ljava/lang/Short;", GetShort, AppendFloat)
-          DO_ARG("Ljava/lang/Byte;", GetByte, AppendFloat)
-          DO_FAIL("float")
+        case Primitive::kPrimDouble:
+          AppendDouble(value.GetD());
           break;
-        case 'D':
-          DO_FIRST_ARG("Ljava/lang/Double;", GetDouble, AppendDouble)
-          DO_ARG("Ljava/lang/Float;", GetFloat, AppendDouble)
-          DO_ARG("Ljava/lang/Long;", GetLong, AppendDouble)
-          DO_ARG("Ljava/lang/Integer;", GetInt, AppendDouble)
-          DO_ARG("Ljava/lang/Character;", GetChar, AppendDouble)
-          DO_ARG("Ljava/lang/Short;", GetShort, AppendDouble)
-          DO_ARG("Ljava/lang/Byte;", GetByte, AppendDouble)
-          DO_FAIL("double")
-          break;
-#ifndef NDEBUG
         default:
-          LOG(FATAL) << "Unexpected shorty character: " << shorty_[i];
-          UNREACHABLE();
-#endif
+          Append(value.GetI());
+          break;
       }
-#undef DO_FIRST_ARG
-#undef DO_ARG
-#undef DO_FAIL
     }
     return true;
   }
@@ -290,6 +290,7 @@ Runtime::Runtime()
       test_api_policy_(hiddenapi::EnforcementPolicy::kDisabled),
       dedupe_hidden_api_warnings_(true),
       hidden_api_access_event_log_rate_(0),
+      hidden_api_dex_flags_cache_(new hiddenapi::DexFlagsCache()),
       dump_native_stack_on_sig_quit_(true),
       pruned_dalvik_cache_(false),
       // Initially assume we perceive jank in case the process state is never updated.
@@ -1636,6 +1637,8 @@ bool Runtime::Init(RuntimeArgumentMap&& runtime_options_in) {
 
   verifier::ClassVerifier::Init(class_linker_);
 
+  metrics_snapshot_file_ = runtime_options.ReleaseOrDefault(Opt::MetricsSnapshotFile);
+
   if (runtime_options.Exists(Opt::MethodTrace)) {
     trace_config_.reset(new TraceConfig());
     trace_config_->trace_file = runtime_options.ReleaseOrDefault(Opt::MethodTraceFile);
@@ -2010,6 +2013,27 @@ void Runtime::DumpDeoptimizations(std::ostream& os) {
   }
 }
 
+void Runtime::WriteMetricsSnapshot() {
+  if (metrics_snapshot_file_.empty()) {
+    return;
+  }
+  std::vector<uint8_t> snapshot;
+  metrics_.WriteSnapshot(&snapshot);
+  std::unique_ptr<File> file(OS::CreateEmptyFileWriteOnly(metrics_snapshot_file_.c_str()));
+  if (file == nullptr) {
+    PLOG(WARNING) << "Unable to open metrics snapshot file " << metrics_snapshot_file_;
+    return;
+  }
+  if (!file->WriteFully(snapshot.data(), snapshot.size())) {
+    PLOG(WARNING) << "Unable to write metrics snapshot file " << metrics_snapshot_file_;
+    file->Erase();
+    return;
+  }
+  if (file->FlushCloseOrErase() != 0) {
+    PLOG(WARNING) << "Unable to close metrics snapshot file " << metrics_snapshot_file_;
+  }
+}
+
 void Runtime::DumpForSigQuit(std::ostream& os) {
   GetClassLinker()->DumpForSigQuit(os);
   GetInternTable()->DumpForSigQuit(os);
@@ -2023,6 +2047,8 @@ void Runtime::DumpForSigQuit(std::ostream& os) {
   }
   DumpDeoptimizations(os);
   TrackedAllocators::Dump(os);
+  metrics_.DumpForSigQuit(os);
+  WriteMetricsSnapshot();
   os << "\n";
 
   thread_list_->DumpForSigQuit(os);
@@ -30,6 +30,7 @@
 #include "base/locks.h"
 #include "base/macros.h"
 #include "base/mem_map.h"
+#include "base/metrics.h"
 #include "base/string_view_cpp20.h"
 #include "deoptimization_kind.h"
 #include "dex/dex_file_types.h"
@@ -55,6 +56,7 @@ class Heap;
 }  // namespace gc
 
 namespace hiddenapi {
+class DexFlagsCache;
 enum class EnforcementPolicy;
 }  // namespace hiddenapi
 
@@ -272,6 +274,9 @@ class Runtime {
   void DumpForSigQuit(std::ostream& os);
   void DumpLockHolders(std::ostream& os);
 
+  // Write a binary snapshot of the metrics to the file given by -Xmetrics-snapshot-file, if any.
+  void WriteMetricsSnapshot();
+
   ~Runtime();
 
   const std::vector<std::string>& GetBootClassPath() const {
@@ -479,6 +484,11 @@ class Runtime {
     return &stats_;
   }
 
+  // Always-on counters and histograms, unlike RuntimeStats which need to be enabled.
+  metrics::ArtMetrics* GetMetrics() {
+    return &metrics_;
+  }
+
   bool HasStatsEnabled() const {
     return stats_enabled_;
   }
@@ -632,6 +642,10 @@ class Runtime {
     return hidden_api_access_event_log_rate_;
   }
 
+  hiddenapi::DexFlagsCache* GetHiddenApiDexFlagsCache() const {
+    return hidden_api_dex_flags_cache_.get();
+  }
+
   const std::string& GetProcessPackageName() const {
     return process_package_name_;
   }
@@ -1148,6 +1162,9 @@ class Runtime {
   bool stats_enabled_;
   RuntimeStats stats_;
 
+  metrics::ArtMetrics metrics_;
+  std::string metrics_snapshot_file_;
+
   const bool is_running_on_memory_tool_;
 
   std::unique_ptr<TraceConfig> trace_config_;
@@ -1273,6 +1290,9 @@ class Runtime {
   // (never) and 0x10000 (always).
   uint32_t hidden_api_access_event_log_rate_;
 
+  // Hiddenapi dex flags of boot class path members, decoded on demand.
+  std::unique_ptr<hiddenapi::DexFlagsCache> hidden_api_dex_flags_cache_;
+
   // The package of the app running in this process.
   std::string process_package_name_;
 
@@ -94,11 +94,12 @@ size_t CodeInfo::Deduper::Dedupe(const uint8_t* code_info_data) {
   // The back-reference offset takes space so dedupe is not worth it for tiny tables.
   constexpr size_t kMinDedupSize = 32;  // Assume 32-bit offset on average.
 
-  // Read the existing code info and find (and keep) dedup-map iterator for each table.
-  // The iterator stores BitMemoryRegion and bit_offset of previous identical BitTable.
-  std::map<BitMemoryRegion, uint32_t, BitMemoryRegion::Less>::iterator it[kNumBitTables];
+  // Read the existing code info and find (and keep) dedup-map entry for each table.
+  // The entry stores BitMemoryRegion and bit_offset of previous identical BitTable.
+  // Note that we keep pointers rather than iterators as rehashing invalidates the latter.
+  std::pair<const BitMemoryRegion, uint32_t>* it[kNumBitTables];
   CodeInfo code_info(code_info_data, nullptr, [&](size_t i, auto*, BitMemoryRegion region) {
-    it[i] = dedupe_map_.emplace(region, /*bit_offset=*/0).first;
+    it[i] = &*dedupe_map_.emplace(region, /*bit_offset=*/0).first;
     if (it[i]->second != 0 && region.size_in_bits() > kMinDedupSize) {  // Seen before and large?
       code_info.SetBitTableDeduped(i);  // Mark as deduped before we write header.
     }
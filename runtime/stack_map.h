@@ -18,6 +18,7 @@
 #define ART_RUNTIME_STACK_MAP_H_
 
 #include <limits>
+#include <unordered_map>
 
 #include "arch/instruction_set.h"
 #include "base/bit_memory_region.h"
@@ -288,7 +289,10 @@ class CodeInfo {
     BitMemoryWriter<std::vector<uint8_t>> writer_;
 
     // Deduplicate at BitTable level. The value is bit offset within the output.
-    std::map<BitMemoryRegion, uint32_t, BitMemoryRegion::Less> dedupe_map_;
+    std::unordered_map<BitMemoryRegion,
+                       uint32_t,
+                       BitMemoryRegion::ContentHash,
+                       BitMemoryRegion::ContentEquals> dedupe_map_;
   };
 
   ALWAYS_INLINE CodeInfo() {}
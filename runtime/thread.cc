@@ -3832,10 +3832,16 @@ class ReferenceMapVisitor : public StackVisitor {
 
       T vreg_info(m, code_info, map, visitor_);
 
-      // Visit stack entries that hold pointers.
+      // Visit stack entries that hold pointers. Stack masks are mostly clear, so load them
+      // 32 bits at a time and only visit the set bits.
       BitMemoryRegion stack_mask = code_info.GetStackMaskOf(map);
-      for (size_t i = 0; i < stack_mask.size_in_bits(); ++i) {
-        if (stack_mask.LoadBit(i)) {
+      const size_t stack_mask_bits = stack_mask.size_in_bits();
+      for (size_t base = 0; base < stack_mask_bits; base += BitSizeOf<uint32_t>()) {
+        const size_t num_bits = std::min<size_t>(BitSizeOf<uint32_t>(), stack_mask_bits - base);
+        for (uint32_t bits = static_cast<uint32_t>(stack_mask.LoadBits(base, num_bits));
+             bits != 0u;
+             bits &= bits - 1u) {
+          const size_t i = base + CTZ(bits);
           StackReference<mirror::Object>* ref_addr = vreg_base + i;
           mirror::Object* ref = ref_addr->AsMirrorPtr();
           if (ref != nullptr) {
@@ -3848,21 +3854,20 @@ class ReferenceMapVisitor : public StackVisitor {
         }
       }
       // Visit callee-save registers that hold pointers.
-      uint32_t register_mask = code_info.GetRegisterMaskOf(map);
-      for (size_t i = 0; i < BitSizeOf<uint32_t>(); ++i) {
-        if (register_mask & (1 << i)) {
-          mirror::Object** ref_addr = reinterpret_cast<mirror::Object**>(GetGPRAddress(i));
-          if (kIsDebugBuild && ref_addr == nullptr) {
-            std::string thread_name;
-            GetThread()->GetThreadName(thread_name);
-            LOG(FATAL_WITHOUT_ABORT) << "On thread " << thread_name;
-            DescribeStack(GetThread());
-            LOG(FATAL) << "Found an unsaved callee-save register " << i << " (null GPRAddress) "
-                       << "set in register_mask=" << register_mask << " at " << DescribeLocation();
-          }
-          if (*ref_addr != nullptr) {
-            vreg_info.VisitRegister(ref_addr, i, this);
-          }
+      const uint32_t register_mask = code_info.GetRegisterMaskOf(map);
+      for (uint32_t bits = register_mask; bits != 0u; bits &= bits - 1u) {
+        const size_t i = CTZ(bits);
+        mirror::Object** ref_addr = reinterpret_cast<mirror::Object**>(GetGPRAddress(i));
+        if (kIsDebugBuild && ref_addr == nullptr) {
+          std::string thread_name;
+          GetThread()->GetThreadName(thread_name);
+          LOG(FATAL_WITHOUT_ABORT) << "On thread " << thread_name;
+          DescribeStack(GetThread());
+          LOG(FATAL) << "Found an unsaved callee-save register " << i << " (null GPRAddress) "
+                     << "set in register_mask=" << register_mask << " at " << DescribeLocation();
+        }
+        if (*ref_addr != nullptr) {
+          vreg_info.VisitRegister(ref_addr, i, this);
         }
       }
     } else if (!m->IsRuntimeMethod() && m->IsProxyMethod()) {
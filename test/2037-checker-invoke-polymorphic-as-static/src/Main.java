@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2020 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import annotations.ConstantMethodHandle;
+import java.lang.invoke.MethodHandle;
+
+public class Main {
+    private static void unreachable() {
+        throw new Error("Unreachable");
+    }
+
+    private static void assertEquals(long expected, long actual) {
+        if (expected != actual) {
+            throw new AssertionError("Assertion failure: " + expected + " != " + actual);
+        }
+    }
+
+    public static int add(int a, int b) {
+        return a + b;
+    }
+
+    // Calls to this method are replaced by a const-method-handle by the build transformer.
+    @ConstantMethodHandle(
+            kind = ConstantMethodHandle.INVOKE_STATIC,
+            owner = "Main",
+            fieldOrMethodName = "add",
+            descriptor = "(II)I")
+    private static MethodHandle addHandle() {
+        unreachable();
+        return null;
+    }
+
+    /// CHECK-START: int Main.callInvokeExact(int, int) builder (after)
+    /// CHECK:          InvokeStaticOrDirect method_name:Main.add
+
+    /// CHECK-START: int Main.callInvokeExact(int, int) builder (after)
+    /// CHECK-NOT:      InvokePolymorphic
+    public static int callInvokeExact(int a, int b) throws Throwable {
+        return (int) addHandle().invokeExact(a, b);
+    }
+
+    /// CHECK-START: int Main.callInvoke(int, int) builder (after)
+    /// CHECK:          InvokeStaticOrDirect method_name:Main.add
+
+    /// CHECK-START: int Main.callInvoke(int, int) builder (after)
+    /// CHECK-NOT:      InvokePolymorphic
+    public static int callInvoke(int a, int b) throws Throwable {
+        return (int) addHandle().invoke(a, b);
+    }
+
+    // The call site type (II)J differs from the handle type (II)I, so invoke() needs
+    // the return value conversion done by the runtime.
+
+    /// CHECK-START: long Main.callInvokeWithOtherType(int, int) builder (after)
+    /// CHECK:          InvokePolymorphic
+
+    /// CHECK-START: long Main.callInvokeWithOtherType(int, int) builder (after)
+    /// CHECK-NOT:      InvokeStaticOrDirect method_name:Main.add
+    public static long callInvokeWithOtherType(int a, int b) throws Throwable {
+        return (long) addHandle().invoke(a, b);
+    }
+
+    public static void main(String[] args) throws Throwable {
+        System.loadLibrary(args[0]);
+        if (hasJit()) {
+            ensureJitCompiled(Main.class, "callInvokeExact");
+            ensureJitCompiled(Main.class, "callInvoke");
+            ensureJitCompiled(Main.class, "callInvokeWithOtherType");
+        }
+        assertEquals(3, callInvokeExact(1, 2));
+        assertEquals(7, callInvoke(3, 4));
+        assertEquals(11L, callInvokeWithOtherType(5, 6));
+        System.out.println("passed");
+    }
+
+    public static native boolean hasJit();
+    public static native void ensureJitCompiled(Class<?> cls, String methodName);
+}